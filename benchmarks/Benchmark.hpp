@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace gf::benchmark
+{
+    /**
+     * @brief Keep the compiler from optimizing away a value
+    */
+    template <typename T>
+    void keep(const T& value)
+    {
+        static volatile const T* sink;
+        sink = &value;
+        (void)sink;
+    }
+
+    /**
+     * @brief Time a function and print the time per operation
+     *
+     * The function is run once to warm up, then repeated until a tenth of a second has passed.
+     *
+     * @param name The name printed next to the result
+     * @param operations The number of operations in one call of the function
+     * @param function The function to time
+     * @return The mean time per operation in nanoseconds
+    */
+    template <typename Function>
+    double measure(const char* name, std::size_t operations, Function&& function)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        function();
+
+        std::size_t repetitions = 0;
+        Clock::duration elapsed{};
+        auto start = Clock::now();
+        do
+        {
+            function();
+            ++repetitions;
+            elapsed = Clock::now() - start;
+        } while (elapsed < std::chrono::milliseconds(100));
+
+        double nanoseconds = std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(repetitions * operations);
+        std::printf("%-40s %10.3f ns/op\n", name, nanoseconds);
+        return nanoseconds;
+    }
+
+} // namespace gf::benchmark
@@ -0,0 +1,70 @@
+#include <GameForge/GameForge.hpp>
+#include "Benchmark.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace gf;
+
+namespace
+{
+    struct Curve
+    {
+        const char* name;
+        Easing_type type;
+    };
+
+    const Curve curves[] = {
+        {"in_quad", Easing_type::in_quad},
+        {"in_out_cubic", Easing_type::in_out_cubic},
+        {"in_sine", Easing_type::in_sine},
+        {"in_out_sine", Easing_type::in_out_sine},
+        {"out_expo", Easing_type::out_expo},
+        {"in_out_expo", Easing_type::in_out_expo},
+        {"in_out_circ", Easing_type::in_out_circ},
+    };
+}
+
+int main()
+{
+    constexpr std::size_t count = 1 << 16;
+    std::vector<float> times(count);
+    std::vector<float> results(count);
+
+    // A scrambled order, so that table lookups do not simply stream through the table
+    for (std::size_t i = 0; i < count; ++i)
+        times[i] = static_cast<float>((i * 7919) % count) / static_cast<float>(count - 1);
+
+    for (const Curve& curve : curves)
+    {
+        std::printf("%s, table error %.2g\n", curve.name, easing::get_table(curve.type).get_max_error());
+
+        benchmark::measure("  analytic, one call per value", count, [&]()
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                results[i] = easing::evaluate(curve.type, times[i]);
+            benchmark::keep(results[count - 1]);
+        });
+
+        benchmark::measure("  analytic, batch", count, [&]()
+        {
+            easing::evaluate(curve.type, times.data(), results.data(), count);
+            benchmark::keep(results[count - 1]);
+        });
+
+        const Easing_table& table = easing::get_table(curve.type);
+        benchmark::measure("  table, one call per value", count, [&]()
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                results[i] = table(times[i]);
+            benchmark::keep(results[count - 1]);
+        });
+
+        benchmark::measure("  table, batch", count, [&]()
+        {
+            table.evaluate(times.data(), results.data(), count);
+            benchmark::keep(results[count - 1]);
+        });
+    }
+}
@@ -0,0 +1,91 @@
+#include <GameForge/GameForge.hpp>
+#include "Benchmark.hpp"
+
+#include <cstdio>
+#include <vector>
+
+using namespace gf;
+
+/**
+ * Compares Fixed against float for the work a lockstep simulation does every step: integrating
+ * positions, rotating vectors by an angle each and transforming points.
+*/
+int main()
+{
+    constexpr std::size_t count = 4096;
+
+    std::vector<Vector2f> float_positions(count);
+    std::vector<Vector2f> float_velocities(count);
+    std::vector<Angle> float_angles(count);
+    std::vector<Vector2x> fixed_positions(count);
+    std::vector<Vector2x> fixed_velocities(count);
+    std::vector<Fixed_angle> fixed_angles(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        float value = static_cast<float>(i % 100) * 0.01f;
+        float_positions[i] = Vector2f(value, 1.0f - value);
+        float_velocities[i] = Vector2f(0.001f, -0.001f);
+        float_angles[i] = Angle{value * 6.0f};
+        fixed_positions[i] = Vector2x(Fixed{value}, Fixed{1.0f - value});
+        fixed_velocities[i] = Vector2x(Fixed{0.001f}, Fixed{-0.001f});
+        fixed_angles[i] = Fixed_angle::from_angle(float_angles[i]);
+    }
+
+    std::printf("Integrate positions\n");
+    benchmark::measure("  float", count, [&]()
+    {
+        const float dt = 0.016f;
+        for (std::size_t i = 0; i < count; ++i)
+            float_positions[i] += float_velocities[i] * dt;
+        benchmark::keep(float_positions.back());
+    });
+    benchmark::measure("  Fixed", count, [&]()
+    {
+        const Fixed dt{0.016f};
+        for (std::size_t i = 0; i < count; ++i)
+            fixed_positions[i] += fixed_velocities[i] * dt;
+        benchmark::keep(fixed_positions.back());
+    });
+
+    std::printf("\nRotate by an angle each\n");
+    benchmark::measure("  float, standard library", count, [&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            float_velocities[i] = float_velocities[i].get_rotated(float_angles[i]);
+        benchmark::keep(float_velocities.back());
+    });
+    benchmark::measure("  float, high precision polynomial", count, [&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Sin_cos sin_cos = float_angles[i].sincos(Trig_precision::high);
+            Vector2f& v = float_velocities[i];
+            v = Vector2f(v.x * sin_cos.cos - v.y * sin_cos.sin, v.x * sin_cos.sin + v.y * sin_cos.cos);
+        }
+        benchmark::keep(float_velocities.back());
+    });
+    benchmark::measure("  Fixed, table", count, [&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            fixed_velocities[i] = get_rotated(fixed_velocities[i], fixed_angles[i]);
+        benchmark::keep(fixed_velocities.back());
+    });
+
+    std::printf("\nTransform points\n");
+    Transform2 float_transform(Vector2f(3.0f, -2.0f), Angle{0.5f}, Vector2f(2.0f, 2.0f));
+    Fixed_transform2 fixed_transform(Vector2x(Fixed{3}, Fixed{-2}), Fixed_angle::from_angle(Angle{0.5f}), Vector2x(Fixed{2}, Fixed{2}));
+    std::vector<Vector2f> float_points(count);
+    std::vector<Vector2x> fixed_points(count);
+    benchmark::measure("  Transform2", count, [&]()
+    {
+        float_transform.transform_points(float_positions.data(), float_points.data(), count);
+        benchmark::keep(float_points.back());
+    });
+    benchmark::measure("  Fixed_transform2", count, [&]()
+    {
+        fixed_transform.transform_points(fixed_positions.data(), fixed_points.data(), count);
+        benchmark::keep(fixed_points.back());
+    });
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <GameForge/GameForge.hpp>
+#include "Benchmark.hpp"
+
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+using namespace gf;
+
+namespace
+{
+    /**
+     * @brief Time constructing, copying and calling a callback type with a capture of a given size
+    */
+    template <typename Function, typename Make>
+    void compare(const char* type_name, Make make)
+    {
+        constexpr std::size_t count = 4096;
+        std::vector<Function> functions;
+        functions.reserve(count);
+        float total = 0.0f;
+
+        std::printf("%s\n", type_name);
+
+        benchmark::measure("  construct", count, [&]()
+        {
+            functions.clear();
+            for (std::size_t i = 0; i < count; ++i)
+                functions.emplace_back(make(static_cast<float>(i), total));
+            benchmark::keep(functions.back());
+        });
+
+        std::vector<Function> copies;
+        copies.reserve(count);
+        benchmark::measure("  copy", count, [&]()
+        {
+            copies.clear();
+            for (const Function& function : functions)
+                copies.push_back(function);
+            benchmark::keep(copies.back());
+        });
+
+        benchmark::measure("  call", count, [&]()
+        {
+            for (const Function& function : functions)
+                function();
+            benchmark::keep(total);
+        });
+    }
+
+    /**
+     * @brief A callback capturing a pointer and a float, which fits the small buffer of common std::function implementations
+    */
+    auto make_small = [](float value, float& total)
+    {
+        float* target = &total;
+        return [target, value]() { *target += value; };
+    };
+
+    /**
+     * @brief A callback capturing three pointers and a float, which std::function typically moves to the heap
+    */
+    auto make_large = [](float value, float& total)
+    {
+        float* target = &total;
+        const float* a = nullptr;
+        const float* b = nullptr;
+        return [target, a, b, value]() { *target += value + (a ? *a : 0.0f) + (b ? *b : 0.0f); };
+    };
+}
+
+int main()
+{
+    float total = 0.0f;
+    std::printf("Capture of %zu bytes\n", sizeof(make_small(0.0f, total)));
+    compare<std::function<void()>>("std::function", make_small);
+    compare<Inplace_function<void()>>("Inplace_function", make_small);
+
+    std::printf("\nCapture of %zu bytes\n", sizeof(make_large(0.0f, total)));
+    compare<std::function<void()>>("std::function", make_large);
+    compare<Inplace_function<void()>>("Inplace_function", make_large);
+
+    std::printf("\nClock with a callback\n");
+    float fired = 0.0f;
+    benchmark::measure("  construct and tick", 1, [&]()
+    {
+        float* target = &fired;
+        const float* a = nullptr;
+        const float* b = nullptr;
+        Clock clock(Time(1.0f), [target, a, b]() { *target += 1.0f + (a ? *a : 0.0f) + (b ? *b : 0.0f); });
+        clock.tick(Time(1.0f));
+        benchmark::keep(fired);
+    });
+
+    return 0;
+}
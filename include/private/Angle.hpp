@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <string>
 #include <iostream>
 
@@ -8,6 +9,25 @@ namespace gf
 {
     constexpr float M_PI{3.14159265f};   ///< The value of pi to 8 decimal places, defined as a constant here because it is not defined in the cmath header
 
+    /**
+     * @brief How trigonometric functions trade accuracy for speed
+    */
+    enum class Trig_precision : std::uint8_t
+    {
+        exact, ///< The standard library
+        high, ///< Polynomials within about 1e-7 of the standard library, a couple of ulp
+        fast ///< Polynomials within about 1.5e-5 of the standard library
+    };
+
+    /**
+     * @brief The sine and cosine of an angle
+    */
+    struct Sin_cos
+    {
+        float sin;
+        float cos;
+    };
+
     /**
      * @brief A class to represent an angle in degrees or radians
     */
@@ -63,7 +83,7 @@ namespace gf
         /**
          * @brief Get the angle in degrees.
         */
-        float get_degrees() const
+        constexpr float get_degrees() const
         {
             return radians * 180.0f / M_PI;
         }
@@ -81,6 +101,25 @@ namespace gf
         */
         Angle get_mod(const Angle& angle) const;
 
+        /**
+         * @brief Get the same angle with whole turns taken off, in [-pi, pi]
+         *
+         * The turns are taken off in double, so the polynomial tiers of sincos stay accurate for an
+         * angle that has accumulated far past the range they reduce well on their own. Angles too
+         * large for that, or not a number, are returned unchanged.
+        */
+        constexpr Angle get_reduced() const
+        {
+            constexpr double two_pi = 6.283185307179586476925;
+            double value = radians;
+            if (!(value > -1e18 && value < 1e18))
+                return *this;
+
+            double turns = value / two_pi;
+            auto whole_turns = static_cast<long long>(turns + ((turns < 0) ? -0.5 : 0.5));
+            return Angle(value - static_cast<double>(whole_turns) * two_pi);
+        }
+
         /**
          * @brief Get the angle as a string.
          * 
@@ -104,6 +143,48 @@ namespace gf
         */
         float cos() const;
 
+        /**
+         * @brief Get the sine and cosine of the angle together
+         *
+         * Compilers turn the pair of standard library calls into a single sincos call where the platform has one.
+        */
+        Sin_cos sincos() const;
+
+        /**
+         * @brief Get the sine and cosine of the angle with a chosen precision
+         *
+         * The polynomial tiers reduce the angle to [-pi/4, pi/4] by multiples of pi/2 and evaluate
+         * short polynomials inline, sharing the reduction between the sine and the cosine. They hold
+         * their accuracy for angles up to about 1e4 radians, and can be evaluated at compile time,
+         * the exact tier cannot.
+        */
+        constexpr Sin_cos sincos(Trig_precision precision) const;
+
+        /**
+         * @brief Get the sine of the angle with a chosen precision, at compile time for the polynomial tiers
+        */
+        constexpr float sin(Trig_precision precision) const
+        {
+            return sincos(precision).sin;
+        }
+
+        /**
+         * @brief Get the cosine of the angle with a chosen precision, at compile time for the polynomial tiers
+        */
+        constexpr float cos(Trig_precision precision) const
+        {
+            return sincos(precision).cos;
+        }
+
+        /**
+         * @brief Get the tangent of the angle with a chosen precision, at compile time for the polynomial tiers
+        */
+        constexpr float tan(Trig_precision precision) const
+        {
+            Sin_cos sin_cos = sincos(precision);
+            return sin_cos.sin / sin_cos.cos;
+        }
+
         /**
          * @brief Get the tangent of the angle.
          * 
@@ -141,7 +222,10 @@ namespace gf
          * @param other The angle to add.
          * @return The sum of the two angles.
          */
-        Angle operator+(const Angle& other) const;
+        constexpr Angle operator+(const Angle& other) const
+        {
+            return Angle{radians + other.radians};
+        }
 
         /**
          * @brief Subtract an angle from another angle.
@@ -149,14 +233,20 @@ namespace gf
          * @param other The angle to subtract.
          * @return The difference between the two angles.
          */
-        Angle operator-(const Angle& other) const;
+        constexpr Angle operator-(const Angle& other) const
+        {
+            return Angle{radians - other.radians};
+        }
 
         /**
          * @brief Negate the angle.
          * 
          * @return The negated angle.
          */
-        Angle operator-() const;
+        constexpr Angle operator-() const
+        {
+            return Angle{-radians};
+        }
         
         /**
          * @brief Multiply the angle by a scalar value.
@@ -164,7 +254,10 @@ namespace gf
          * @param scalar The scalar value to multiply by.
          * @return The multiplied angle.
          */
-        Angle operator*(const float scalar) const;
+        constexpr Angle operator*(const float scalar) const
+        {
+            return Angle{radians * scalar};
+        }
 
         /**
          * @brief Divide the angle by a scalar value.
@@ -172,7 +265,10 @@ namespace gf
          * @param scalar The scalar value to divide by.
          * @return The divided angle.
          */
-        Angle operator/(const float scalar) const;
+        constexpr Angle operator/(const float scalar) const
+        {
+            return Angle{radians / scalar};
+        }
 
         /**
          * @brief Add another angle to the current angle.
@@ -180,7 +276,11 @@ namespace gf
          * @param other The angle to add.
          * @return A reference to the current angle after addition.
          */
-        Angle& operator+=(const Angle& other);
+        constexpr Angle& operator+=(const Angle& other)
+        {
+            radians += other.radians;
+            return *this;
+        }
 
         /**
          * @brief Subtract another angle from the current angle.
@@ -188,7 +288,11 @@ namespace gf
          * @param other The angle to subtract.
          * @return A reference to the current angle after subtraction.
          */
-        Angle& operator-=(const Angle& other);
+        constexpr Angle& operator-=(const Angle& other)
+        {
+            radians -= other.radians;
+            return *this;
+        }
 
         /**
          * @brief Multiply the current angle by a scalar value.
@@ -196,7 +300,11 @@ namespace gf
          * @param scalar The scalar value to multiply by.
          * @return A reference to the current angle after multiplication.
          */
-        Angle& operator*=(const float scalar);
+        constexpr Angle& operator*=(const float scalar)
+        {
+            radians *= scalar;
+            return *this;
+        }
         
         /**
          * @brief Divide the current angle by a scalar value.
@@ -204,7 +312,11 @@ namespace gf
          * @param scalar The scalar value to divide by.
          * @return A reference to the current angle after division.
          */
-        Angle& operator/=(const float scalar);
+        constexpr Angle& operator/=(const float scalar)
+        {
+            radians /= scalar;
+            return *this;
+        }
 
         /* Comparison Operators*/
 
@@ -214,7 +326,10 @@ namespace gf
          * @param other The angle to compare with.
          * @return True if the angles are equal, false otherwise.
          */
-        bool operator==(const Angle& other) const;
+        constexpr bool operator==(const Angle& other) const
+        {
+            return radians == other.radians;
+        }
 
         /**
          * @brief Check if two angles are not equal.
@@ -222,7 +337,10 @@ namespace gf
          * @param other The angle to compare with.
          * @return True if the angles are not equal, false otherwise.
          */
-        bool operator!=(const Angle& other) const;
+        constexpr bool operator!=(const Angle& other) const
+        {
+            return !(*this == other);
+        }
 
         /**
          * @brief Check if the current angle is less than another angle.
@@ -230,7 +348,10 @@ namespace gf
          * @param other The angle to compare with.
          * @return True if the current angle is less than the other angle, false otherwise.
          */
-        bool operator<(const Angle& other) const;
+        constexpr bool operator<(const Angle& other) const
+        {
+            return radians < other.radians;
+        }
 
         /**
          * @brief Check if the current angle is greater than another angle.
@@ -238,7 +359,10 @@ namespace gf
          * @param other The angle to compare with.
          * @return True if the current angle is greater than the other angle, false otherwise.
          */
-        bool operator>(const Angle& other) const;
+        constexpr bool operator>(const Angle& other) const
+        {
+            return radians > other.radians;
+        }
 
         /**
          * @brief Check if the current angle is less than or equal to another angle.
@@ -246,7 +370,10 @@ namespace gf
          * @param other The angle to compare with.
          * @return True if the current angle is less than or equal to the other angle, false otherwise.
          */
-        bool operator<=(const Angle& other) const;
+        constexpr bool operator<=(const Angle& other) const
+        {
+            return !(*this > other);
+        }
 
         /**
          * @brief Check if the current angle is greater than or equal to another angle.
@@ -254,7 +381,10 @@ namespace gf
          * @param other The angle to compare with.
          * @return True if the current angle is greater than or equal to the other angle, false otherwise.
          */
-        bool operator>=(const Angle& other) const;
+        constexpr bool operator>=(const Angle& other) const
+        {
+            return !(*this < other);
+        }
 
         /* Printing utilities */
 
@@ -273,10 +403,73 @@ namespace gf
 
     };
 
+    namespace detail
+    {
+        /**
+         * Constants of the polynomial sine and cosine, shared by Angle::sincos and the batch functions.
+         * pi/2 is split in three parts whose leading bits are few enough that multiplying them by the
+         * quadrant is exact, so the reduced angle keeps its precision.
+        */
+        constexpr float two_over_pi = 0.636619772f;
+        constexpr float half_pi_part1 = 1.5703125f;
+        constexpr float half_pi_part2 = 4.837512969970703125e-4f;
+        constexpr float half_pi_part3 = 7.54978995489188216e-8f;
+        constexpr float round_to_integer = 12582912.0f;
+
+        // Minimax polynomials on [-pi/4, pi/4], the high ones from Cephes
+        constexpr float sin_high[] = {-1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f};
+        constexpr float cos_high[] = {4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f};
+        constexpr float sin_fast[] = {-1.66628338e-1f, 8.15299182e-3f};
+        constexpr float cos_fast[] = {-4.99776306e-1f, 4.04889321e-2f};
+    } // namespace detail
+
+    constexpr Sin_cos Angle::sincos(Trig_precision precision) const
+    {
+        if (precision == Trig_precision::exact)
+            return sincos();
+
+        // Adding and taking away 1.5 * 2^23 rounds to the nearest even integer like the SIMD round does
+        float q = (radians * detail::two_over_pi + detail::round_to_integer) - detail::round_to_integer;
+        auto quadrant = static_cast<std::int32_t>(q);
+        float r = ((radians - q * detail::half_pi_part1) - q * detail::half_pi_part2) - q * detail::half_pi_part3;
+        float r2 = r * r;
+
+        float sin_r = 0.0f;
+        float cos_r = 0.0f;
+        if (precision == Trig_precision::high)
+        {
+            sin_r = r + r * r2 * (detail::sin_high[0] + r2 * (detail::sin_high[1] + r2 * detail::sin_high[2]));
+            cos_r = 1.0f - 0.5f * r2 + r2 * r2 * (detail::cos_high[0] + r2 * (detail::cos_high[1] + r2 * detail::cos_high[2]));
+        }
+        else
+        {
+            sin_r = r + r * r2 * (detail::sin_fast[0] + r2 * detail::sin_fast[1]);
+            cos_r = 1.0f + r2 * (detail::cos_fast[0] + r2 * detail::cos_fast[1]);
+        }
+
+        // Each quarter turn maps (sin, cos) to (cos, -sin)
+        switch (quadrant & 3)
+        {
+            case 0: return {sin_r, cos_r};
+            case 1: return {cos_r, -sin_r};
+            case 2: return {-sin_r, -cos_r};
+            default: return {-cos_r, sin_r};
+        }
+    }
+
     /* Constants for convenience */
     constexpr Angle PI{M_PI};           ///< The value of pi as an angle for efficiency
     constexpr Angle TWO_PI{2.0f * M_PI}; ///< The value of 2 * pi as an angle for efficiency
 
+    /**
+     * @brief Wrap two angles in radians so that interpolating from one to the other takes the shortest path
+     *
+     * Both are reduced modulo 2 * pi, then the end is moved by a whole turn if the two are more
+     * than pi apart. Angular_linear_process, Transform_linear_process and the batched systems all
+     * wrap their rotations with it.
+    */
+    void wrap_shortest_path(float& start_radians, float& end_radians);
+
 } // namespace gf
 
 /* Literals */
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "Time.hpp"
-#include <functional>
+#include "Inplace_function.hpp"
 
 namespace gf
 {
@@ -9,8 +9,8 @@ namespace gf
     {
     public:
         Clock(const Time& length);
-        Clock(const Time& length, const std::function<void()>& new_callback);
-        Clock(const Time& length, const Time& elapsed, const std::function<void()>& new_callback);
+        Clock(const Time& length, const Inplace_function<void()>& new_callback);
+        Clock(const Time& length, const Time& elapsed, const Inplace_function<void()>& new_callback);
         void restart();
         void reset(const Time& length);
 
@@ -24,12 +24,12 @@ namespace gf
 
         void tick(const Time& delta_time);
 
-        void add_callback(const std::function<void()>& new_callback);
+        void add_callback(const Inplace_function<void()>& new_callback);
 
     private:
         Time length;
         Time elapsed;
-        std::function<void()> callback;
+        Inplace_function<void()> callback;
     };
 
 } // namespace gf
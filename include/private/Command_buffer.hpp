@@ -0,0 +1,137 @@
+#pragma once
+
+#include <functional>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Game_object.hpp"
+#include "World.hpp"
+
+namespace gf
+{
+    /**
+     * @brief Records structural changes to the objects of a world and applies them later in one batch
+     *
+     * Adding children and components while the hierarchy is being updated would modify the vectors
+     * being iterated, so components record the changes here instead and they are applied at a sync
+     * point between updates. Commands can be recorded from several threads at once.
+     *
+     * When applied, spawns and reparents are sorted by parent so that each parent's child list grows
+     * once and receives its new children in handle order, component additions are grouped by owner,
+     * and destroys run last. When a child is reparented several times only the last recorded
+     * reparent is applied. Commands targeting objects that no longer exist are skipped.
+    */
+    class Command_buffer
+    {
+        public:
+            using Initializer = std::function<void(Game_object&)>;
+
+            /**
+             * @brief Construct a command buffer for a world
+             *
+             * @param world The world objects are spawned in and destroyed from, it must outlive the buffer
+            */
+            explicit Command_buffer(World& world);
+
+            /**
+             * @brief Record the creation of an object
+             *
+             * @param parent The parent of the new object, or a null handle to create a root
+             * @param initializer Called with the new object once it has been created
+            */
+            void spawn(Game_object_handle parent, Initializer initializer = {});
+
+            /**
+             * @brief Record moving an object to a new parent
+             *
+             * @param child The object to move
+             * @param new_parent The new parent, or a null handle to make the object a root
+            */
+            void reparent(Game_object_handle child, Game_object_handle new_parent);
+
+            /**
+             * @brief Record adding a pooled component to an object
+             *
+             * @see World::add_component
+            */
+            template <typename Component, typename... Args>
+            void add_component(Game_object_handle owner, Args&&... args)
+            {
+                record_component(owner, [arguments = std::make_tuple(std::forward<Args>(args)...)](World& world, Game_object& object) mutable
+                {
+                    std::apply([&world, &object](auto&&... unpacked)
+                    {
+                        world.add_component<Component>(object, std::move(unpacked)...);
+                    }, std::move(arguments));
+                });
+            }
+
+            /**
+             * @brief Record adding a component to the world's type-bucketed component stores
+             *
+             * @see Component_registry::add
+            */
+            template <typename Component, typename... Args>
+            void add_stored_component(Game_object_handle owner, Args&&... args)
+            {
+                record_component(owner, [arguments = std::make_tuple(std::forward<Args>(args)...)](World& world, Game_object& object) mutable
+                {
+                    std::apply([&world, &object](auto&&... unpacked)
+                    {
+                        world.get_components().add<Component>(object, std::move(unpacked)...);
+                    }, std::move(arguments));
+                });
+            }
+
+            /**
+             * @brief Record the destruction of an object and its subtree
+            */
+            void destroy(Game_object_handle object);
+
+            /**
+             * @brief Apply every recorded command and empty the buffer
+             *
+             * Must not be called while the world's objects are being updated. If a command throws, it is
+             * dropped, the commands not yet applied stay recorded and the exception is rethrown.
+            */
+            void apply();
+
+            /**
+             * @brief Check whether no commands are recorded
+            */
+            bool empty() const;
+
+        private:
+            using Component_factory = std::function<void(World&, Game_object&)>;
+
+            struct Spawn_command
+            {
+                Game_object_handle parent;
+                Initializer initializer;
+            };
+
+            struct Reparent_command
+            {
+                Game_object_handle child;
+                Game_object_handle new_parent;
+            };
+
+            struct Component_command
+            {
+                Game_object_handle owner;
+                Component_factory factory;
+            };
+
+            void record_component(Game_object_handle owner, Component_factory factory);
+
+            World& world;
+            mutable std::mutex mutex;
+            std::vector<Spawn_command> spawns;
+            std::vector<Reparent_command> reparents;
+            std::vector<Component_command> component_additions;
+            std::vector<Game_object_handle> destroys;
+    };
+
+} // namespace gf
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Game_object.hpp"
+#include "Game_object_component.hpp"
+#include "Time.hpp"
+
+namespace gf
+{
+    /**
+     * @brief The type independent interface of a Component_store
+    */
+    class Component_store_base
+    {
+        public:
+            virtual ~Component_store_base() = default;
+
+            /**
+             * @brief Update every component in the store
+            */
+            virtual void update(const gf::Time& dt) = 0;
+
+            /**
+             * @brief Remove the component of an object, if it has one
+            */
+            virtual void remove(const Game_object& owner) = 0;
+
+            /**
+             * @brief Get the number of components in the store
+            */
+            virtual std::size_t size() const = 0;
+    };
+
+    /**
+     * @brief A sparse set of components of a single type
+     *
+     * The components are stored contiguously and by value, so updating the store is one tight
+     * loop of statically dispatched calls. Components are found from their owner's handle index
+     * through a sparse array, in constant time. Each object can own at most one component of the type.
+     * Removing a component moves the last component into its place, so pointers and references
+     * to components are invalidated by adding and removing components.
+     *
+     * @tparam Component The component type, which must be move constructible and have an update(const Time&) member
+    */
+    template <typename Component>
+    class Component_store : public Component_store_base
+    {
+        public:
+            /**
+             * @brief Construct a component for an object
+             *
+             * The component is constructed from the owner followed by the arguments if it can be,
+             * otherwise from the arguments alone. Components derived from Game_object_component have
+             * their owner set.
+             *
+             * @param owner The object owning the component
+             * @param args The arguments to construct the component with
+             * @return The new component
+            */
+            template <typename... Args>
+            Component& add(Game_object& owner, Args&&... args)
+            {
+                if (contains(owner))
+                {
+                    throw std::invalid_argument("Object already has a component of this type");
+                }
+
+                if constexpr (std::is_constructible_v<Component, Game_object&, Args...>)
+                    components.emplace_back(owner, std::forward<Args>(args)...);
+                else
+                    components.emplace_back(std::forward<Args>(args)...);
+
+                if constexpr (std::is_base_of_v<Game_object_component, Component>)
+                    components.back().set_owner(&owner);
+
+                std::uint32_t owner_index = owner.get_handle().get_index();
+                if (owner_index >= sparse.size())
+                    sparse.resize(owner_index + 1, null_index);
+
+                sparse[owner_index] = static_cast<std::uint32_t>(owners.size());
+                owners.push_back(owner.get_handle());
+                return components.back();
+            }
+
+            /**
+             * @brief Get the component of an object
+             *
+             * @return The component, or nullptr if the object has none
+            */
+            Component* get(const Game_object& owner)
+            {
+                std::uint32_t index = find(owner.get_handle());
+                return (index == null_index) ? nullptr : &components[index];
+            }
+
+            const Component* get(const Game_object& owner) const
+            {
+                std::uint32_t index = find(owner.get_handle());
+                return (index == null_index) ? nullptr : &components[index];
+            }
+
+            bool contains(const Game_object& owner) const
+            {
+                return find(owner.get_handle()) != null_index;
+            }
+
+            void remove(const Game_object& owner) override
+            {
+                std::uint32_t removed = find(owner.get_handle());
+                if (removed == null_index)
+                    return;
+
+                std::uint32_t last = static_cast<std::uint32_t>(components.size() - 1);
+                sparse[owners[removed].get_index()] = null_index;
+
+                if (removed != last)
+                {
+                    relocate(components[removed], components[last]);
+                    owners[removed] = owners[last];
+                    sparse[owners[removed].get_index()] = removed;
+                }
+                components.pop_back();
+                owners.pop_back();
+            }
+
+            void update(const gf::Time& dt) override
+            {
+                for (auto& component : components)
+                {
+                    // Qualified so that the call is not dispatched virtually
+                    component.Component::update(dt);
+                }
+            }
+
+            std::size_t size() const override
+            {
+                return components.size();
+            }
+
+            /**
+             * @brief Get the object owning the component at an index
+            */
+            Game_object_handle get_owner(std::size_t index) const
+            {
+                return owners[index];
+            }
+
+            Component* begin() { return components.data(); }
+            Component* end() { return components.data() + components.size(); }
+            const Component* begin() const { return components.data(); }
+            const Component* end() const { return components.data() + components.size(); }
+
+        private:
+            static constexpr std::uint32_t null_index = Handle<Game_object>::null_index;
+
+            std::uint32_t find(Game_object_handle owner) const
+            {
+                if (owner.get_index() >= sparse.size())
+                    return null_index;
+
+                std::uint32_t index = sparse[owner.get_index()];
+                return (index != null_index && owners[index] == owner) ? index : null_index;
+            }
+
+            static void relocate(Component& destination, Component& source)
+            {
+                if constexpr (std::is_move_assignable_v<Component>)
+                {
+                    destination = std::move(source);
+                }
+                else
+                {
+                    destination.~Component();
+                    new (&destination) Component(std::move(source));
+                }
+            }
+
+            std::vector<Component> components; ///< The components, densely packed
+            std::vector<Game_object_handle> owners; ///< The owner of each component
+            std::vector<std::uint32_t> sparse; ///< The index of the component of each owner, indexed by handle index
+    };
+
+    /**
+     * @brief A collection of component stores, one per component type
+     *
+     * Updating the registry updates every store in the order its first component was added, so
+     * all components of one type are updated back to back. Components added to the registry are
+     * not part of Game_object::components and are not updated by Game_object::update.
+    */
+    class Component_registry
+    {
+        public:
+            /**
+             * @brief Construct a component for an object in the store of its type
+             *
+             * @see Component_store::add
+            */
+            template <typename Component, typename... Args>
+            Component& add(Game_object& owner, Args&&... args)
+            {
+                return get_store<Component>().add(owner, std::forward<Args>(args)...);
+            }
+
+            /**
+             * @brief Get the component of a type of an object
+             *
+             * @return The component, or nullptr if the object has none
+            */
+            template <typename Component>
+            Component* get(const Game_object& owner)
+            {
+                Component_store<Component>* store = find_store<Component>();
+                return store ? store->get(owner) : nullptr;
+            }
+
+            template <typename Component>
+            void remove(const Game_object& owner)
+            {
+                if (Component_store<Component>* store = find_store<Component>())
+                    store->remove(owner);
+            }
+
+            /**
+             * @brief Remove every component of an object, which must be done before the object is destroyed
+            */
+            void remove_all(const Game_object& owner)
+            {
+                for (auto& store : stores)
+                    store->remove(owner);
+            }
+
+            /**
+             * @brief Get the store of a component type, creating it if needed
+            */
+            template <typename Component>
+            Component_store<Component>& get_store()
+            {
+                auto index = store_indices.find(typeid(Component));
+                if (index == store_indices.end())
+                {
+                    index = store_indices.emplace(typeid(Component), stores.size()).first;
+                    stores.push_back(std::make_unique<Component_store<Component>>());
+                }
+                return static_cast<Component_store<Component>&>(*stores[index->second]);
+            }
+
+            /**
+             * @brief Update every store, one component type at a time
+            */
+            void update(const gf::Time& dt)
+            {
+                for (auto& store : stores)
+                    store->update(dt);
+            }
+
+        private:
+            template <typename Component>
+            Component_store<Component>* find_store()
+            {
+                auto index = store_indices.find(typeid(Component));
+                return (index == store_indices.end()) ? nullptr : static_cast<Component_store<Component>*>(stores[index->second].get());
+            }
+
+            std::unordered_map<std::type_index, std::size_t> store_indices;
+            std::vector<std::unique_ptr<Component_store_base>> stores;
+    };
+
+} // namespace gf
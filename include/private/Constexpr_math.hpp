@@ -0,0 +1,142 @@
+#pragma once
+
+#include <stdexcept>
+
+namespace gf::constexpr_math
+{
+    /**
+     * Math functions that can be evaluated at compile time, for baking tables and constants into
+     * the binary. They work in double and converge to double precision, so a result converted to
+     * float is almost always the float the standard library gives. They are slower than the
+     * standard library at run time, use them where the result is a constant.
+    */
+
+    constexpr double pi = 3.14159265358979323846;
+
+    namespace detail
+    {
+        // pi / 2 as a sum of two doubles, so reducing by it keeps the precision of the remainder
+        constexpr double half_pi_high = 1.5707963267948966;
+        constexpr double half_pi_low = 6.123233995736766e-17;
+
+        /**
+         * @brief Round to the nearest integer, half away from zero, for values that fit a long long
+        */
+        constexpr long long round_to_integer(double x)
+        {
+            return static_cast<long long>(x + ((x < 0) ? -0.5 : 0.5));
+        }
+
+        /**
+         * @brief Sine by its Taylor series, for |r| <= pi / 4 where 12 terms reach double precision
+        */
+        constexpr double sin_reduced(double r)
+        {
+            double r2 = r * r;
+            double term = r;
+            double sum = r;
+            for (int n = 1; n < 12; ++n)
+            {
+                term *= -r2 / ((2 * n) * (2 * n + 1));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief Cosine by its Taylor series, for |r| <= pi / 4
+        */
+        constexpr double cos_reduced(double r)
+        {
+            double r2 = r * r;
+            double term = 1.0;
+            double sum = 1.0;
+            for (int n = 1; n < 12; ++n)
+            {
+                term *= -r2 / ((2 * n - 1) * (2 * n));
+                sum += term;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief The sine of x shifted by a number of quarter turns
+        */
+        constexpr double sin_quadrant(double x, long long quarter_turns)
+        {
+            long long quadrant = round_to_integer(x / half_pi_high);
+            double r = (x - quadrant * half_pi_high) - quadrant * half_pi_low;
+            switch (((quadrant + quarter_turns) % 4 + 4) % 4)
+            {
+                case 0: return sin_reduced(r);
+                case 1: return cos_reduced(r);
+                case 2: return -sin_reduced(r);
+                default: return -cos_reduced(r);
+            }
+        }
+    } // namespace detail
+
+    constexpr double sin(double x)
+    {
+        return detail::sin_quadrant(x, 0);
+    }
+
+    constexpr double cos(double x)
+    {
+        return detail::sin_quadrant(x, 1);
+    }
+
+    constexpr double tan(double x)
+    {
+        return sin(x) / cos(x);
+    }
+
+    /**
+     * @throws std::domain_error If x is negative
+    */
+    constexpr double sqrt(double x)
+    {
+        if (x < 0)
+        {
+            throw std::domain_error("Square root of a negative number");
+        }
+        if (x == 0)
+        {
+            return 0;
+        }
+
+        // Newton's method converges from above once past the first step, stop when it stops falling
+        double root = (x > 1) ? x : 1;
+        for (int i = 0; i < 1100; ++i)
+        {
+            double next = 0.5 * (root + x / root);
+            if (next >= root)
+                break;
+            root = next;
+        }
+        return root;
+    }
+
+    constexpr double exp2(double x)
+    {
+        // 2^x = 2^n * e^(f ln 2) with n an integer and f in [0, 1)
+        long long n = static_cast<long long>(x);
+        if (static_cast<double>(n) > x)
+            --n;
+        double y = (x - static_cast<double>(n)) * 0.6931471805599453;
+
+        double term = 1.0;
+        double sum = 1.0;
+        for (int k = 1; k < 20; ++k)
+        {
+            term *= y / k;
+            sum += term;
+        }
+
+        for (; n > 0; --n)
+            sum *= 2.0;
+        for (; n < 0; ++n)
+            sum *= 0.5;
+        return sum;
+    }
+} // namespace gf::constexpr_math
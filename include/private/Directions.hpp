@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "Angle.hpp"
+#include "Constexpr_math.hpp"
+#include "Vector2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief Build the unit vectors of Count evenly spaced headings, counter clockwise from (1, 0)
+     *
+     * Each heading is reduced to a quarter turn exactly before any trigonometry, so headings on
+     * the axes come out as exact zeros and ones rather than values like 6e-17.
+    */
+    template <std::size_t Count>
+    constexpr std::array<Vector2f, Count> make_directions()
+    {
+        static_assert(Count > 0, "A direction table needs at least one direction");
+
+        std::array<Vector2f, Count> directions{};
+        for (std::size_t i = 0; i < Count; ++i)
+        {
+            // The heading i / Count of a turn is quadrant quarter turns plus the remainder in [0, pi / 2)
+            std::size_t quarters = 4 * i;
+            std::size_t quadrant = quarters / Count;
+            double r = static_cast<double>(quarters % Count) * (constexpr_math::pi / 2) / static_cast<double>(Count);
+            double sin_of = (r == 0) ? 0.0 : constexpr_math::sin(r);
+            double cos_of = (r == 0) ? 1.0 : constexpr_math::cos(r);
+
+            switch (quadrant)
+            {
+                case 0: directions[i] = Vector2f(cos_of, sin_of); break;
+                case 1: directions[i] = Vector2f(-sin_of, cos_of); break;
+                case 2: directions[i] = Vector2f(-cos_of, -sin_of); break;
+                default: directions[i] = Vector2f(sin_of, -cos_of); break;
+            }
+        }
+        return directions;
+    }
+
+    /**
+     * @brief The unit vectors of Count evenly spaced headings, baked into the binary
+     *
+     * directions<8>[2] is (0, 1), directions<16>[1] points 22.5 degrees counter clockwise of (1, 0).
+    */
+    template <std::size_t Count>
+    inline constexpr std::array<Vector2f, Count> directions = make_directions<Count>();
+
+    /**
+     * @brief Get the index in directions<Count> of the heading nearest to an angle
+    */
+    template <std::size_t Count>
+    constexpr std::size_t get_direction_index(const Angle& angle)
+    {
+        double steps = static_cast<double>(angle.get_radians()) * Count / (2 * constexpr_math::pi);
+        long long nearest = constexpr_math::detail::round_to_integer(steps);
+        long long count = static_cast<long long>(Count);
+        return static_cast<std::size_t>((nearest % count + count) % count);
+    }
+} // namespace gf
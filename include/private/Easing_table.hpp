@@ -0,0 +1,211 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Constexpr_math.hpp"
+#include "Interpolation.hpp"
+
+namespace gf
+{
+    /**
+     * @brief An easing function sampled into a lookup table
+     *
+     * Evaluating the table costs two loads and a linear interpolation whatever the curve, which
+     * beats the sine, expo and circ easings that call into the standard library. The price is an
+     * approximation error that shrinks with the square of the sample count. The maximum error is
+     * measured against the function when the table is built and can be read with get_max_error.
+     *
+     * Measured maximum errors of the built in easing functions, at 64, 256 (the default) and 1024 samples:
+     * - linear: exact up to rounding
+     * - quad: 6.3e-5, 3.9e-6, 3.6e-7, twice that for in_out_quad
+     * - cubic: 1.9e-4, 1.2e-5, 8.8e-7, twice that for in_out_cubic
+     * - quart: 3.7e-4, 2.3e-5, 1.6e-6, twice that for in_out_quart
+     * - quint: 6.2e-4, 3.8e-5, 2.5e-6, twice that for in_out_quint
+     * - sine: 7.8e-5, 4.8e-6, 3.6e-7, twice that for in_out_sine
+     * - expo: 1.4e-3, 9.2e-4, 9.2e-4, from the jump to exactly 0 or 1 at the ends, which no resolution removes
+     * - circ: 4.5e-2, 2.2e-2, 1.1e-2, half that for in_out_circ, near the ends where the slope is vertical
+     *
+     * Circ curves only halve their error per doubling of the sample count, so they are better left analytic.
+     *
+     * For the built in functions at a fixed sample count, Static_easing_table builds the same table at compile time.
+    */
+    class Easing_table
+    {
+        public:
+            static constexpr std::size_t default_sample_count = 256;
+
+            /**
+             * @brief Sample an easing function
+             *
+             * @param function The easing function to sample
+             * @param sample_count The number of evenly spaced samples over [0, 1], including both ends
+             * @throws std::invalid_argument If there are fewer than two samples
+            */
+            explicit Easing_table(const Easing_function& function, std::size_t sample_count = default_sample_count);
+
+            /**
+             * @brief Evaluate the table, clamping t to [0, 1]
+            */
+            float operator()(float t) const
+            {
+                float x = t * scale;
+                x = (x > 0.0f) ? ((x < scale) ? x : scale) : 0.0f;
+                // A signed 32 bit conversion is a single instruction, unlike one to size_t
+                auto index = static_cast<std::int32_t>(x);
+                float fraction = x - static_cast<float>(index);
+                return samples[index] + (samples[index + 1] - samples[index]) * fraction;
+            }
+
+            /**
+             * @brief Evaluate the table over an array
+             *
+             * @param t The normalized times
+             * @param result The eased times, may alias t
+             * @param count The number of times
+            */
+            void evaluate(const float* t, float* result, std::size_t count) const;
+
+            std::size_t get_sample_count() const;
+
+            /**
+             * @brief Get the largest difference from the sampled function, measured between samples when the table was built
+            */
+            float get_max_error() const;
+
+        private:
+            std::vector<float> samples; ///< The samples, with the last one repeated so that t = 1 needs no special case
+            float scale; ///< The number of intervals between samples
+            float max_error;
+    };
+
+    namespace easing
+    {
+        /**
+         * @brief Evaluate a built in easing function at compile time
+         *
+         * The same formulas as the functions in easing, with the sine, expo and circ curves computed
+         * in double by constexpr_math, so results match to within a float rounding.
+        */
+        constexpr float evaluate_constant(Easing_type type, float t)
+        {
+            constexpr double half_pi = constexpr_math::pi / 2;
+            double u = t;
+            switch (type)
+            {
+                case Easing_type::linear: return linear(t);
+                case Easing_type::in_quad: return in_quad(t);
+                case Easing_type::out_quad: return out_quad(t);
+                case Easing_type::in_out_quad: return in_out_quad(t);
+                case Easing_type::in_cubic: return in_cubic(t);
+                case Easing_type::out_cubic: return out_cubic(t);
+                case Easing_type::in_out_cubic: return in_out_cubic(t);
+                case Easing_type::in_quart: return in_quart(t);
+                case Easing_type::out_quart: return out_quart(t);
+                case Easing_type::in_out_quart: return in_out_quart(t);
+                case Easing_type::in_quint: return in_quint(t);
+                case Easing_type::out_quint: return out_quint(t);
+                case Easing_type::in_out_quint: return in_out_quint(t);
+                case Easing_type::in_sine: return static_cast<float>(1 - constexpr_math::cos(u * half_pi));
+                case Easing_type::out_sine: return static_cast<float>(constexpr_math::sin(u * half_pi));
+                case Easing_type::in_out_sine: return static_cast<float>(0.5 * (1 - constexpr_math::cos(u * constexpr_math::pi)));
+                case Easing_type::in_expo: return (t == 0) ? 0.0f : static_cast<float>(constexpr_math::exp2(10 * (u - 1)));
+                case Easing_type::out_expo: return (t == 1) ? 1.0f : static_cast<float>(1 - constexpr_math::exp2(-10 * u));
+                case Easing_type::in_out_expo:
+                    if (t == 0 || t == 1)
+                        return t;
+                    return static_cast<float>((t < 0.5f) ? 0.5 * constexpr_math::exp2(20 * u - 10) : 1 - 0.5 * constexpr_math::exp2(-20 * u + 10));
+                case Easing_type::in_circ: return static_cast<float>(1 - constexpr_math::sqrt(1 - u * u));
+                case Easing_type::out_circ: return static_cast<float>(constexpr_math::sqrt((2 - u) * u));
+                case Easing_type::in_out_circ:
+                    return static_cast<float>((t < 0.5f)
+                        ? 0.5 * (1 - constexpr_math::sqrt(1 - 4 * u * u))
+                        : 0.5 * (constexpr_math::sqrt(-((2 * u - 3) * (2 * u - 1))) + 1));
+            }
+            throw std::invalid_argument("Invalid easing type");
+        }
+
+        /**
+         * @brief Get the table of a built in easing function at the default sample count
+         *
+         * Every table is built on the first call, which is safe from any thread.
+        */
+        const Easing_table& get_table(Easing_type type);
+    } // namespace easing
+
+    /**
+     * @brief A built in easing function sampled into a lookup table at compile time
+     *
+     * Evaluates exactly like an Easing_table of the same function and sample count, but the
+     * samples are part of the binary, so there is nothing to build at startup and no check that
+     * the table has been built on every call.
+     *
+     * @tparam Sample_count The number of evenly spaced samples over [0, 1], including both ends
+    */
+    template <std::size_t Sample_count = Easing_table::default_sample_count>
+    class Static_easing_table
+    {
+        static_assert(Sample_count >= 2, "An easing table needs at least two samples");
+
+        public:
+            constexpr explicit Static_easing_table(Easing_type type):
+                samples{}
+            {
+                for (std::size_t i = 0; i < Sample_count; ++i)
+                {
+                    samples[i] = easing::evaluate_constant(type, static_cast<float>(i) / scale);
+                }
+                samples[Sample_count] = samples[Sample_count - 1];
+            }
+
+            /**
+             * @brief Evaluate the table, clamping t to [0, 1]
+            */
+            constexpr float operator()(float t) const
+            {
+                float x = t * scale;
+                x = (x > 0.0f) ? ((x < scale) ? x : scale) : 0.0f;
+                auto index = static_cast<std::int32_t>(x);
+                float fraction = x - static_cast<float>(index);
+                return samples[index] + (samples[index + 1] - samples[index]) * fraction;
+            }
+
+            static constexpr std::size_t get_sample_count()
+            {
+                return Sample_count;
+            }
+
+        private:
+            static constexpr float scale = static_cast<float>(Sample_count) - 1.0f; ///< The number of intervals between samples
+
+            std::array<float, Sample_count + 1> samples; ///< The samples, with the last one repeated so that t = 1 needs no special case
+    };
+
+    namespace easing
+    {
+        /**
+         * @brief The table of a built in easing function at the default sample count, baked into the binary
+        */
+        template <Easing_type Type>
+        inline constexpr Static_easing_table<> static_table{Type};
+    } // namespace easing
+
+    /**
+     * @brief A built in easing function evaluated through its table, chosen at compile time
+     *
+     * The table is a Static_easing_table baked into the binary. Use it like Static_easing, as the
+     * easing parameter of lerp, Linear_process or Easing_function.
+    */
+    template <Easing_type Type>
+    struct Table_easing
+    {
+        static constexpr Easing_type type = Type;
+
+        constexpr float operator()(float t) const
+        {
+            return easing::static_table<Type>(t);
+        }
+    };
+
+} // namespace gf
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "Vector2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief A Q16.16 fixed point number, for simulation that must give identical results everywhere
+     *
+     * Every operation is integer arithmetic on the raw value, so results do not depend on the
+     * compiler, its flags or the CPU, unlike float where contraction into fused multiply adds or
+     * differing libm implementations change the last bits. Values range over [-32768, 32768) with
+     * a resolution of 1 / 65536. Overflow wraps around like unsigned integers instead of being
+     * undefined. Multiplication rounds to nearest, division truncates towards zero.
+     *
+     * Conversions from float and double are for constants and input, they are exact for the same
+     * float value on every platform but the float itself may not be.
+    */
+    class Fixed
+    {
+        public:
+            using Raw = std::int32_t;
+
+            static constexpr int fraction_bits = 16;
+            static constexpr Raw one_raw = Raw{1} << fraction_bits;
+
+            constexpr Fixed():
+                raw{}
+            {}
+
+            /**
+             * @brief Construct from an integer, which must fit in the 16 integer bits
+            */
+            template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+            constexpr explicit Fixed(T value):
+                raw{wrap(static_cast<std::int64_t>(value) * one_raw)}
+            {}
+
+            /**
+             * @brief Construct from a floating point value, rounding half away from zero
+            */
+            template <typename T, std::enable_if_t<std::is_floating_point_v<T>, int> = 0>
+            constexpr explicit Fixed(T value):
+                raw{wrap(static_cast<std::int64_t>(static_cast<double>(value) * one_raw + ((value < 0) ? -0.5 : 0.5)))}
+            {}
+
+            /**
+             * @brief Construct from the raw Q16.16 representation
+            */
+            static constexpr Fixed from_raw(Raw raw)
+            {
+                Fixed result;
+                result.raw = raw;
+                return result;
+            }
+
+            constexpr Raw get_raw() const
+            {
+                return raw;
+            }
+
+            constexpr float get_float() const
+            {
+                return static_cast<float>(raw) / one_raw;
+            }
+
+            constexpr double get_double() const
+            {
+                return static_cast<double>(raw) / one_raw;
+            }
+
+            /**
+             * @brief Get the value rounded down to an integer
+            */
+            constexpr std::int32_t get_int() const
+            {
+                return raw >> fraction_bits;
+            }
+
+            /* Arithmetic Operators */
+
+            constexpr Fixed operator+(Fixed other) const { return from_raw(wrap(static_cast<std::int64_t>(raw) + other.raw)); }
+            constexpr Fixed operator-(Fixed other) const { return from_raw(wrap(static_cast<std::int64_t>(raw) - other.raw)); }
+            constexpr Fixed operator-() const { return from_raw(wrap(-static_cast<std::int64_t>(raw))); }
+
+            constexpr Fixed operator*(Fixed other) const
+            {
+                std::int64_t product = static_cast<std::int64_t>(raw) * other.raw;
+                return from_raw(wrap((product + (std::int64_t{1} << (fraction_bits - 1))) >> fraction_bits));
+            }
+
+            /**
+             * @throws std::domain_error If other is zero
+            */
+            constexpr Fixed operator/(Fixed other) const
+            {
+                if (other.raw == 0)
+                {
+                    throw std::domain_error("Fixed point division by zero");
+                }
+                return from_raw(wrap(static_cast<std::int64_t>(raw) * one_raw / other.raw));
+            }
+
+            /**
+             * @brief Multiply by an integer, exactly
+            */
+            template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+            constexpr Fixed operator*(T scalar) const
+            {
+                return from_raw(wrap(static_cast<std::int64_t>(raw) * static_cast<std::int64_t>(scalar)));
+            }
+
+            /**
+             * @brief Divide by an integer, truncating towards zero
+             *
+             * @throws std::domain_error If scalar is zero
+            */
+            template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+            constexpr Fixed operator/(T scalar) const
+            {
+                if (scalar == 0)
+                {
+                    throw std::domain_error("Fixed point division by zero");
+                }
+                return from_raw(wrap(static_cast<std::int64_t>(raw) / static_cast<std::int64_t>(scalar)));
+            }
+
+            constexpr Fixed& operator+=(Fixed other) { return *this = *this + other; }
+            constexpr Fixed& operator-=(Fixed other) { return *this = *this - other; }
+            constexpr Fixed& operator*=(Fixed other) { return *this = *this * other; }
+            constexpr Fixed& operator/=(Fixed other) { return *this = *this / other; }
+
+            /* Comparison Operators */
+
+            constexpr bool operator==(Fixed other) const { return raw == other.raw; }
+            constexpr bool operator!=(Fixed other) const { return raw != other.raw; }
+            constexpr bool operator<(Fixed other) const { return raw < other.raw; }
+            constexpr bool operator>(Fixed other) const { return raw > other.raw; }
+            constexpr bool operator<=(Fixed other) const { return raw <= other.raw; }
+            constexpr bool operator>=(Fixed other) const { return raw >= other.raw; }
+
+        private:
+            /**
+             * @brief Reduce a wide result to 32 bits modulo 2^32
+            */
+            static constexpr Raw wrap(std::int64_t value)
+            {
+                return static_cast<Raw>(static_cast<std::uint32_t>(value));
+            }
+
+            Raw raw; ///< The value times 65536
+    };
+
+    /**
+     * @brief The absolute value, found by Vector2 through argument dependent lookup
+    */
+    constexpr Fixed abs(Fixed value)
+    {
+        return (value < Fixed{}) ? -value : value;
+    }
+
+    /**
+     * @brief The square root rounded down, computed a bit at a time
+     *
+     * @throws std::domain_error If value is negative
+    */
+    constexpr Fixed sqrt(Fixed value)
+    {
+        if (value < Fixed{})
+        {
+            throw std::domain_error("Square root of a negative fixed point number");
+        }
+
+        // The root of raw * 2^16 is the raw value of the root
+        std::uint64_t remainder = static_cast<std::uint64_t>(value.get_raw()) << Fixed::fraction_bits;
+        std::uint64_t root = 0;
+        std::uint64_t bit = std::uint64_t{1} << 46;
+        while (bit > remainder)
+            bit >>= 2;
+
+        while (bit != 0)
+        {
+            if (remainder >= root + bit)
+            {
+                remainder -= root + bit;
+                root = (root >> 1) + bit;
+            }
+            else
+            {
+                root >>= 1;
+            }
+            bit >>= 2;
+        }
+        return Fixed::from_raw(static_cast<Fixed::Raw>(root));
+    }
+
+    inline std::string to_string(Fixed value)
+    {
+        return std::to_string(value.get_double());
+    }
+
+    inline std::ostream& operator<<(std::ostream& os, Fixed value)
+    {
+        return os << to_string(value);
+    }
+
+    using Vector2x = Vector2<Fixed>; // A vector with fixed point components
+} // namespace gf
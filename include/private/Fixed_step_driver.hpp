@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "Game_object.hpp"
+#include "Job_system.hpp"
+#include "Scene_graph.hpp"
+#include "Time.hpp"
+#include "Transform2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief Runs a simulation in fixed steps from variable frame times
+     *
+     * Frame times are added to an accumulator and the simulation is stepped while a whole step is
+     * available. The remainder is exposed as an interpolation alpha so that rendering can blend
+     * between the previous and current step without running any logic. Frames that would need more
+     * than the maximum number of steps drop the excess time instead of falling further behind.
+     *
+     * Interpolated objects have their global transform stored as the previous transform before
+     * every step. Only registered objects pay for this, so static scenery should not be registered.
+    */
+    class Fixed_step_driver
+    {
+        public:
+            using Step_function = std::function<void(const Time&)>;
+
+            /**
+             * @brief Construct a new Fixed step driver
+             *
+             * @param step The length of a simulation step
+             * @param max_steps_per_frame The most steps run by a single call to advance
+            */
+            explicit Fixed_step_driver(const Time& step, std::size_t max_steps_per_frame = 8);
+
+            /**
+             * @brief Add a frame's time and run every whole step it makes available
+             *
+             * @param frame_time The time since the last frame
+             * @param step_function Called once per step with the step length
+             * @return The number of steps run
+            */
+            std::size_t advance(const Time& frame_time, const Step_function& step_function);
+
+            /**
+             * @brief Add a frame's time and update a hierarchy once per whole step
+             *
+             * The hierarchy's global transforms are current when this returns.
+             *
+             * @param frame_time The time since the last frame
+             * @param root The root of the hierarchy to update
+             * @return The number of steps run
+            */
+            std::size_t advance(const Time& frame_time, Game_object& root);
+
+            /**
+             * @brief Add a frame's time and update a hierarchy in parallel once per whole step
+             *
+             * @see Game_object::update(const Time&, Job_system&)
+            */
+            std::size_t advance(const Time& frame_time, Game_object& root, Job_system& jobs);
+
+            /**
+             * @brief Interpolate an object, storing its previous global transform before every step
+            */
+            void add_interpolated(Game_object& object);
+
+            void remove_interpolated(const Game_object& object);
+
+            /**
+             * @brief Interpolate every node of a scene graph, which copies its global transforms in one pass before every step
+            */
+            void add_interpolated(Scene_graph& scene);
+
+            void remove_interpolated(const Scene_graph& scene);
+
+            /**
+             * @brief Get the transform an object should be rendered with this frame
+            */
+            Transform2 get_interpolated_transform(const Game_object& object) const;
+
+            /**
+             * @brief Get how far the accumulated time is between the last step and the next, in [0, 1)
+            */
+            float get_alpha() const;
+
+            Time get_step() const;
+
+            void set_step(const Time& new_step);
+
+            /**
+             * @brief Get the number of steps run since construction
+            */
+            std::uint64_t get_step_count() const;
+
+            /**
+             * @brief Get the total time dropped because frames needed too many steps
+            */
+            Time get_dropped_time() const;
+
+        private:
+            void store_previous_transforms();
+
+            Time step;
+            std::size_t max_steps_per_frame;
+            Time accumulator;
+            Time dropped_time;
+            std::uint64_t step_count = 0;
+            std::vector<Game_object_handle> interpolated_objects;
+            std::vector<Scene_graph*> interpolated_scenes;
+    };
+
+} // namespace gf
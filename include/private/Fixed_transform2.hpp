@@ -0,0 +1,105 @@
+#pragma once
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include "Fixed.hpp"
+#include "Fixed_angle.hpp"
+#include "Transform2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief A position, rotation and scale in fixed point, for deterministic simulation
+     *
+     * Behaves like Transform2, composing the same way, with every result identical across
+     * compilers and CPUs. Convert to a Transform2 with get_transform for rendering.
+    */
+    struct Fixed_transform2
+    {
+        /* Constructors */
+
+        /**
+         * @brief Construct an identity transform
+        */
+        constexpr Fixed_transform2():
+            position{},
+            rotation{},
+            scale{Fixed{1}, Fixed{1}}
+        {}
+
+        constexpr Fixed_transform2(const Vector2x& position, const Fixed_angle& rotation):
+            position{position},
+            rotation{rotation},
+            scale{Fixed{1}, Fixed{1}}
+        {}
+
+        constexpr Fixed_transform2(const Vector2x& position, const Fixed_angle& rotation, const Vector2x& scale):
+            position{position},
+            rotation{rotation},
+            scale{scale}
+        {}
+
+        /* Getters */
+
+        /**
+         * @brief Convert to a float transform, for rendering
+        */
+        Transform2 get_transform() const;
+
+        std::string get_string() const;
+
+        /* Operators */
+
+        /**
+         * @brief Compose two transforms, the result applies other first and then this.
+         *
+         * Exact in the same cases as Transform2::operator*.
+        */
+        Fixed_transform2 operator*(const Fixed_transform2& other) const;
+
+        /**
+         * @brief Compose a transform with another transform, applying other first.
+        */
+        Fixed_transform2& operator*=(const Fixed_transform2& other);
+
+        bool operator==(const Fixed_transform2& other) const;
+        bool operator!=(const Fixed_transform2& other) const;
+
+        /* Methods */
+
+        /**
+         * @brief Transform a point from the local space of the transform to its parent's space.
+        */
+        Vector2x transform_point(const Vector2x& point) const;
+
+        /**
+         * @brief Transform an offset, scaling and rotating it without translating.
+        */
+        Vector2x transform_vector(const Vector2x& vector) const;
+
+        /**
+         * @brief Transform an array of points, looking up the sine and cosine once.
+         *
+         * @param points The points to transform.
+         * @param result Where to write the transformed points, may be points.
+         * @param count The number of points.
+        */
+        void transform_points(const Vector2x* points, Vector2x* result, std::size_t count) const;
+
+        void translate(const Vector2x& offset);
+        void rotate(const Fixed_angle& angle);
+        void scale_by(const Vector2x& factors);
+
+        /* Print utilities */
+
+        friend std::ostream& operator<<(std::ostream& os, const Fixed_transform2& transform);
+
+        /* Members */
+
+        Vector2x position; ///< The position of the transform.
+        Fixed_angle rotation; ///< The rotation of the transform.
+        Vector2x scale; ///< The scale of the transform.
+    };
+
+    std::ostream& operator<<(std::ostream& os, const Fixed_transform2& transform);
+} // namespace gf
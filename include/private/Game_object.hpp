@@ -1,77 +1,200 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
+#include "Handle.hpp"
+#include "Job_system.hpp"
 #include "Transform2.hpp"
 #include "Vector2.hpp"
 #include "Game_object_component.hpp"
+#include "Scene_graph.hpp"
 
 namespace gf
 {
+    /**
+     * @brief A node in the game object hierarchy
+     *
+     * The global transform of an object is cached and only recomputed when the object's
+     * transform or anchor point, or those of one of its ancestors, has changed. Changes must
+     * go through the setters so that the object can be marked dirty.
+     *
+     * An object owns its components and deletes them when it is destroyed. It does not own its
+     * children: destroying an object detaches it from its parent and turns its children into
+     * roots. Use World to allocate objects and components from pools and destroy whole subtrees.
+     *
+     * Objects refer to each other through generational handles, which resolve to nullptr once the
+     * object they refer to is destroyed and keep resolving when an object is moved. Updates skip and
+     * drop children whose handles no longer resolve. Every world shares one handle table of at most
+     * 4,194,304 live objects, past which construction throws std::length_error. It can be resolved
+     * from any thread without locking while other threads create, move or destroy objects, but
+     * creating, moving and destroying take one process wide mutex, so worlds filled from different
+     * threads contend on it. Only destroying the very object a thread is resolving is a race.
+     *
+     * An object constructed with a Scene_graph is a thin handle to a node of that graph: its
+     * transforms live in the graph's arrays and are updated by the graph's linear sweep. Objects
+     * from different graphs, or with and without a graph, cannot be parented to each other.
+    */
     class Game_object
     {
         public:
             std::vector<Game_object_component*> components;
-            std::vector<Game_object*> children;
-            Game_object* parent;
+            std::vector<Game_object_handle> children;
+            Game_object_handle parent;
+
+            Game_object(Game_object* parent = nullptr);
+
+            /**
+             * @brief Construct a game object whose transforms are stored in a scene graph
+             *
+             * @param scene The scene graph to store the transforms in, it must outlive the object
+             * @param parent The parent of the object, which must belong to the same scene graph
+            */
+            Game_object(Scene_graph& scene, Game_object* parent = nullptr);
+
+            Game_object(const Game_object&) = delete;
+            Game_object& operator=(const Game_object&) = delete;
+
+            /**
+             * @brief Relocate an object
+             *
+             * The new object takes over the handle, children, components and scene graph node of the
+             * old one, so every handle to the old object now resolves to the new one. The old object is
+             * left empty, without a handle, and can be destroyed without side effects.
+            */
+            Game_object(Game_object&& other);
+
+            Game_object& operator=(Game_object&&) = delete;
+
+            ~Game_object();
+
+            /**
+             * @brief Get the handle other objects refer to this object by
+            */
+            Game_object_handle get_handle() const;
+
+            /**
+             * @brief Resolve a handle to an object
+             *
+             * @return The object, or nullptr if it has been destroyed
+            */
+            static Game_object* resolve(Game_object_handle handle);
+
+            /**
+             * @brief Update the global transforms of the dirty part of the hierarchy, then
+             * update the components of every object in it
+             *
+             * @param dt The time since the last update
+            */
+            void update(const gf::Time& dt);
+
+            /**
+             * @brief Update the hierarchy like update, but fan the children's subtrees out across a job system
+             *
+             * Sibling subtrees are updated in parallel and joined before the object's own components
+             * are updated, so every object still sees its children updated before itself and the call
+             * returns only once the whole hierarchy has been updated. Components must only modify objects
+             * in their own subtree, and must record structural changes in a Command_buffer.
+             *
+             * @param dt The time since the last update
+             * @param jobs The job system to run the subtrees on
+            */
+            void update(const gf::Time& dt, Job_system& jobs);
+
+            /**
+             * @brief Add a component, which the object takes ownership of
+             *
+             * Structural changes take effect immediately, so they must not be made while the hierarchy
+             * is being updated. Record them in a Command_buffer instead.
+            */
+            void add_component(Game_object_component* component);
+
+            /**
+             * @brief Attach a child, detaching it from its previous parent first
+             *
+             * @see add_component for when structural changes can be made
+            */
+            void add_child(Game_object* child);
+
+            /**
+             * @brief Detach a child, which becomes a root
+            */
+            void remove_child(Game_object* child);
+
+            void update_components(const gf::Time& dt);
+
+            /**
+             * @brief Recompute the global transforms of every dirty object in this subtree
+             *
+             * Clean subtrees are skipped entirely, so a static hierarchy costs nothing here. For objects
+             * stored in a scene graph this updates the whole graph.
+            */
+            void update_position();
+
+            const Transform2& get_transform() const;
+
+            /**
+             * @brief Set the local transform and mark this subtree dirty
+            */
+            void set_transform(const Transform2& new_transform);
+
+            const Vector2f& get_anchor_point() const;
+
+            /**
+             * @brief Set the point children are attached to and mark this subtree dirty
+            */
+            void set_anchor_point(const Vector2f& new_anchor_point);
+
+            /**
+             * @brief Get the global transform as of the last call to update_position
+            */
+            const Transform2& get_global_transform() const;
+
+            /**
+             * @brief Remember the current global transform as the previous one
+             *
+             * Called by Fixed_step_driver before each simulation step for objects that are interpolated.
+            */
+            void store_previous_transform();
+
+            /**
+             * @brief Get the global transform as of the last call to store_previous_transform
+            */
+            const Transform2& get_previous_global_transform() const;
+
+            /**
+             * @brief Interpolate between the previous and current global transforms
+             *
+             * @param alpha The interpolation factor, 0 gives the previous transform and 1 the current one
+            */
+            Transform2 get_interpolated_transform(float alpha) const;
+
+            /**
+             * @brief Mark the transform as changed so that this subtree is recomputed on the next update
+            */
+            void mark_transform_dirty();
+
+        private:
+            static Concurrent_slot_table<Game_object>& get_slot_table();
+
+            void update_subtree(const gf::Time& dt);
+            void update_subtree(const gf::Time& dt, Job_system& jobs);
+            void propagate_position(const Transform2& parent_anchor, bool force);
+
+            /**
+             * @brief Drop the handles of children that have been destroyed without being detached
+            */
+            void remove_stale_children();
+            Transform2 get_child_anchor() const;
+
+            Game_object_handle handle;
             Transform2 transform;
             Vector2f anchor_point;
             Transform2 global_transform;
-
-            Game_object(Game_object* parent = nullptr):
-                parent(parent)
-            {}
-
-            ~Game_object()
-            {
-                for (auto& component : components)
-                {
-                    delete component;
-                }
-            }
-
-            void update(const gf::Time& dt)
-            {
-                update_position();
-                
-                for (auto& child : children)
-                {
-                    child->update(dt);
-                }
-                
-                update_components(dt);
-            }
-
-            void add_component(Game_object_component* component)
-            {
-                components.push_back(component);
-                component->owner = this;
-            }
-
-            void add_child(Game_object* child)
-            {
-                children.push_back(child);
-                child->parent = this;
-            }
-
-            void update_components(const gf::Time& dt)
-            {
-                for (auto& component : components)
-                {
-                    component->update(dt);
-                }
-            }
-
-            void update_position(Transform2& parent_anchor = Transform2())
-            {
-                global_transform = parent_anchor * transform;
-
-                gf::Vector2f anchor_offset = (anchor_point * transform.get_scale()).get_rotated(transform.get_rotation());
-
-                for (auto& child : children)
-                {
-                    child->update_position(global_transform + anchor_offset);
-                }
-            }
+            Transform2 previous_global_transform;
+            Scene_graph* scene = nullptr; ///< The scene graph storing the transforms, if any
+            Scene_graph::Node_id node = Scene_graph::null_node; ///< The node of this object in the scene graph
+            bool transform_dirty = true; ///< This object's global transform is stale
+            std::atomic<bool> children_dirty{false}; ///< Some descendant's global transform is stale, set from any thread
     };
 
 } // namespace gf
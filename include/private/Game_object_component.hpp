@@ -1,21 +1,24 @@
 #pragma once
 
+#include "Handle.hpp"
 #include "Time.hpp"
 
 namespace gf
 {
     class Game_object;
 
+    using Game_object_handle = Handle<Game_object>;
+
     class Game_object_component
     {
         public:
-            Game_object* owner;
+            Game_object_handle owner;
+
+            virtual ~Game_object_component() = default;
+
             virtual void update(const gf::Time& dt) = 0;
 
-            void set_owner(Game_object* owner)
-            {
-                this->owner = owner;
-            }
+            void set_owner(Game_object* owner);
     };
 
 } // namespace gf
@@ -0,0 +1,385 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace gf
+{
+    /**
+     * @brief A generational reference to an object stored in a Slot_table
+     *
+     * A handle is an index into a slot table plus the generation the slot had when the handle was
+     * created. Destroying the object bumps the generation of its slot, so stale handles resolve to
+     * nullptr instead of to whatever reuses the slot. Handles fit in 64 bits and stay valid when the
+     * object they refer to is moved, as long as the slot table is told about the move.
+     *
+     * @tparam T The type of the referenced object. Handles resolve through a static T::resolve(Handle<T>)
+    */
+    template <typename T>
+    class Handle
+    {
+        public:
+            static constexpr std::uint32_t null_index = std::numeric_limits<std::uint32_t>::max();
+
+            /**
+             * @brief Construct a null handle
+            */
+            constexpr Handle():
+                index{null_index},
+                generation{0}
+            {}
+
+            constexpr Handle(std::uint32_t index, std::uint32_t generation):
+                index{index},
+                generation{generation}
+            {}
+
+            /**
+             * @brief Construct a handle from its packed 64 bit value
+            */
+            static constexpr Handle from_value(std::uint64_t value)
+            {
+                return Handle(static_cast<std::uint32_t>(value), static_cast<std::uint32_t>(value >> 32));
+            }
+
+            /**
+             * @brief Get the handle packed into 64 bits, generation in the high half
+            */
+            constexpr std::uint64_t get_value() const
+            {
+                return (static_cast<std::uint64_t>(generation) << 32) | index;
+            }
+
+            constexpr std::uint32_t get_index() const
+            {
+                return index;
+            }
+
+            constexpr std::uint32_t get_generation() const
+            {
+                return generation;
+            }
+
+            constexpr bool is_null() const
+            {
+                return index == null_index;
+            }
+
+            /**
+             * @brief Resolve the handle
+             *
+             * @return The object, or nullptr if the handle is null or the object has been destroyed
+            */
+            T* get() const
+            {
+                return T::resolve(*this);
+            }
+
+            /**
+             * @brief Resolve the handle, throwing if the object no longer exists
+            */
+            T* operator->() const
+            {
+                T* object = get();
+                if (!object)
+                {
+                    throw std::out_of_range("Handle does not refer to a live object");
+                }
+                return object;
+            }
+
+            T& operator*() const
+            {
+                return *operator->();
+            }
+
+            constexpr bool operator==(const Handle& other) const
+            {
+                return index == other.index && generation == other.generation;
+            }
+
+            constexpr bool operator!=(const Handle& other) const
+            {
+                return !(*this == other);
+            }
+
+            /**
+             * @brief Order handles by index, which is the order of their slots
+            */
+            constexpr bool operator<(const Handle& other) const
+            {
+                if (index != other.index)
+                    return index < other.index;
+                return generation < other.generation;
+            }
+
+        private:
+            std::uint32_t index; ///< The slot of the object
+            std::uint32_t generation; ///< The generation of the slot when the handle was created
+    };
+
+    /**
+     * @brief Maps handles to values in constant time
+     *
+     * Slots are reused after being erased, with their generation bumped so that handles to the erased
+     * value no longer resolve. Inserting may reallocate the table, so it must not happen while other
+     * threads resolve handles, use a Concurrent_slot_table for that.
+     *
+     * @tparam T The handle type tag
+     * @tparam Value The value stored per slot, typically a pointer to the object or its index in some array
+    */
+    template <typename T, typename Value = T*>
+    class Slot_table
+    {
+        public:
+            /**
+             * @brief Store a value in a free slot
+             *
+             * @return The handle to the value
+            */
+            Handle<T> insert(const Value& value)
+            {
+                std::uint32_t index;
+                if (free_head != Handle<T>::null_index)
+                {
+                    index = free_head;
+                    free_head = slots[index].next_free;
+                }
+                else
+                {
+                    index = static_cast<std::uint32_t>(slots.size());
+                    slots.push_back({});
+                }
+
+                slots[index].value = value;
+                slots[index].live = true;
+                return Handle<T>(index, slots[index].generation);
+            }
+
+            /**
+             * @brief Get the value of a handle
+             *
+             * @return A pointer to the value, or nullptr if the handle is stale
+            */
+            Value* find(Handle<T> handle)
+            {
+                return contains(handle) ? &slots[handle.get_index()].value : nullptr;
+            }
+
+            const Value* find(Handle<T> handle) const
+            {
+                return contains(handle) ? &slots[handle.get_index()].value : nullptr;
+            }
+
+            bool contains(Handle<T> handle) const
+            {
+                return handle.get_index() < slots.size()
+                    && slots[handle.get_index()].live
+                    && slots[handle.get_index()].generation == handle.get_generation();
+            }
+
+            /**
+             * @brief Replace the value of a live handle, used when the object it refers to moves
+            */
+            void set(Handle<T> handle, const Value& value)
+            {
+                if (!contains(handle))
+                {
+                    throw std::out_of_range("Handle does not refer to a live slot");
+                }
+                slots[handle.get_index()].value = value;
+            }
+
+            /**
+             * @brief Free the slot of a handle, invalidating every copy of the handle
+            */
+            void erase(Handle<T> handle)
+            {
+                if (!contains(handle))
+                    return;
+
+                Slot& slot = slots[handle.get_index()];
+                slot.live = false;
+                slot.value = Value{};
+                ++slot.generation;
+                slot.next_free = free_head;
+                free_head = handle.get_index();
+            }
+
+            /**
+             * @brief Get the number of slots, live or free, which bounds every handle index
+            */
+            std::size_t capacity() const
+            {
+                return slots.size();
+            }
+
+        private:
+            struct Slot
+            {
+                Value value{};
+                std::uint32_t generation = 0;
+                std::uint32_t next_free = Handle<T>::null_index;
+                bool live = false;
+            };
+
+            std::vector<Slot> slots;
+            std::uint32_t free_head = Handle<T>::null_index;
+    };
+
+    /**
+     * @brief A slot table whose handles can be resolved from any thread while others insert and erase
+     *
+     * Slots live in fixed size chunks that never move, so finding a handle never reads memory that an
+     * insert is reallocating, and finding takes no lock. Inserting, setting and erasing are serialized
+     * by a mutex. Erasing the value of a handle while another thread resolves that same handle is
+     * still a logic error of the caller, the resolve gives either the value or nothing.
+     *
+     * @tparam T The handle type tag
+     * @tparam Value The value stored per slot, which must be trivially copyable
+    */
+    template <typename T, typename Value = T*>
+    class Concurrent_slot_table
+    {
+        static_assert(std::is_trivially_copyable_v<Value>, "Concurrent slot table values are stored in atomics");
+
+        public:
+            static constexpr std::uint32_t chunk_size = 1024;
+            static constexpr std::uint32_t max_chunks = 4096;
+
+            /**
+             * @brief Store a value in a free slot
+             *
+             * @return The handle to the value
+             * @throws std::length_error If every one of the max_chunks * chunk_size slots is live
+            */
+            Handle<T> insert(const Value& value)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                std::uint32_t index;
+                if (free_head != Handle<T>::null_index)
+                {
+                    index = free_head;
+                    free_head = get_slot(index).next_free;
+                }
+                else
+                {
+                    index = slot_count.load(std::memory_order_relaxed);
+                    if (index % chunk_size == 0)
+                    {
+                        if (index / chunk_size == max_chunks)
+                        {
+                            throw std::length_error("Concurrent slot table is full");
+                        }
+                        owned_chunks.push_back(std::make_unique<Slot[]>(chunk_size));
+                        chunks[index / chunk_size].store(owned_chunks.back().get(), std::memory_order_release);
+                    }
+                    slot_count.store(index + 1, std::memory_order_release);
+                }
+
+                Slot& slot = get_slot(index);
+                slot.value.store(value, std::memory_order_release);
+                slot.live.store(true, std::memory_order_release);
+                return Handle<T>(index, slot.generation.load(std::memory_order_relaxed));
+            }
+
+            /**
+             * @brief Get the value of a handle
+             *
+             * @return The value, or a value initialized Value if the handle is stale
+            */
+            Value find(Handle<T> handle) const
+            {
+                std::uint32_t index = handle.get_index();
+                if (index >= slot_count.load(std::memory_order_acquire))
+                    return Value{};
+
+                const Slot& slot = get_slot(index);
+                if (slot.generation.load(std::memory_order_acquire) != handle.get_generation())
+                    return Value{};
+                Value value = slot.value.load(std::memory_order_acquire);
+                bool live = slot.live.load(std::memory_order_acquire);
+
+                // Erasing bumps the generation before clearing the value, so checking it again rules
+                // out a value that was stored for a later generation of the slot
+                if (!live || slot.generation.load(std::memory_order_acquire) != handle.get_generation())
+                    return Value{};
+                return value;
+            }
+
+            bool contains(Handle<T> handle) const
+            {
+                std::uint32_t index = handle.get_index();
+                return index < slot_count.load(std::memory_order_acquire)
+                    && get_slot(index).live.load(std::memory_order_acquire)
+                    && get_slot(index).generation.load(std::memory_order_acquire) == handle.get_generation();
+            }
+
+            /**
+             * @brief Replace the value of a live handle, used when the object it refers to moves
+            */
+            void set(Handle<T> handle, const Value& value)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!contains(handle))
+                {
+                    throw std::out_of_range("Handle does not refer to a live slot");
+                }
+                get_slot(handle.get_index()).value.store(value, std::memory_order_release);
+            }
+
+            /**
+             * @brief Free the slot of a handle, invalidating every copy of the handle
+            */
+            void erase(Handle<T> handle)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!contains(handle))
+                    return;
+
+                Slot& slot = get_slot(handle.get_index());
+                slot.generation.store(handle.get_generation() + 1, std::memory_order_release);
+                slot.live.store(false, std::memory_order_release);
+                slot.value.store(Value{}, std::memory_order_release);
+                slot.next_free = free_head;
+                free_head = handle.get_index();
+            }
+
+            /**
+             * @brief Get the number of slots, live or free, which bounds every handle index
+            */
+            std::size_t capacity() const
+            {
+                return slot_count.load(std::memory_order_acquire);
+            }
+
+        private:
+            struct Slot
+            {
+                std::atomic<Value> value{Value{}};
+                std::atomic<std::uint32_t> generation{0};
+                std::atomic<bool> live{false};
+                std::uint32_t next_free = Handle<T>::null_index; ///< Only touched under the mutex
+            };
+
+            Slot& get_slot(std::uint32_t index) const
+            {
+                return chunks[index / chunk_size].load(std::memory_order_acquire)[index % chunk_size];
+            }
+
+            std::array<std::atomic<Slot*>, max_chunks> chunks{};
+            std::atomic<std::uint32_t> slot_count{0};
+            std::vector<std::unique_ptr<Slot[]>> owned_chunks;
+            std::uint32_t free_head = Handle<T>::null_index;
+            std::mutex mutex;
+    };
+
+} // namespace gf
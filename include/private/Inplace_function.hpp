@@ -0,0 +1,257 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace gf
+{
+    template <typename Signature, std::size_t Capacity = 32>
+    class Inplace_function;
+
+    /**
+     * @brief A std::function that stores small callables inside itself instead of allocating them
+     *
+     * The callable is constructed in a fixed buffer of Capacity bytes. One that does not fit, is over
+     * aligned or may throw when moved is allocated on the heap instead, like std::function does, so
+     * any callable is accepted and moving the function never throws. Calling goes through a single function
+     * pointer, and an empty function points at a stub that throws std::bad_function_call, so a call
+     * does not test for emptiness first. Callables that are trivially copyable, such as function
+     * pointers and lambdas capturing only pointers and numbers, are copied with a memcpy.
+     *
+     * @tparam Signature The call signature, like Result(Args...)
+     * @tparam Capacity The size of the buffer in bytes
+    */
+    template <typename Result, typename... Args, std::size_t Capacity>
+    class Inplace_function<Result(Args...), Capacity>
+    {
+        public:
+            static constexpr std::size_t capacity = Capacity;
+
+            static_assert(Capacity >= sizeof(void*), "An Inplace_function must at least hold a pointer to a heap allocated callable");
+
+            /**
+             * @brief Check whether a callable is stored in the buffer, otherwise it is allocated on the heap
+            */
+            template <typename Callable>
+            static constexpr bool stores_inline = sizeof(Callable) <= Capacity
+                && alignof(Callable) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible_v<Callable>;
+
+            /**
+             * @brief Construct an empty function
+            */
+            Inplace_function() noexcept = default;
+
+            Inplace_function(std::nullptr_t) noexcept
+            {}
+
+            /**
+             * @brief Construct a function holding a copy of a callable
+             *
+             * A null function pointer gives an empty function.
+            */
+            template <typename Function, typename = std::enable_if_t<
+                !std::is_same_v<std::decay_t<Function>, Inplace_function>
+                && std::is_invocable_r_v<Result, std::decay_t<Function>&, Args...>>>
+            Inplace_function(Function&& function)
+            {
+                using Callable = std::decay_t<Function>;
+                static_assert(std::is_copy_constructible_v<Callable>, "An Inplace_function needs a copyable callable");
+
+                if constexpr (std::is_pointer_v<Callable> || std::is_member_pointer_v<Callable>)
+                {
+                    if (function == nullptr)
+                        return;
+                }
+
+                if constexpr (stores_inline<Callable>)
+                {
+                    ::new (static_cast<void*>(storage)) Callable(std::forward<Function>(function));
+                    invoke = &invoke_callable<Callable>;
+                    if constexpr (!std::is_trivially_copyable_v<Callable> || !std::is_trivially_destructible_v<Callable>)
+                        manage = &manage_callable<Callable>;
+                }
+                else
+                {
+                    ::new (static_cast<void*>(storage)) Callable*(new Callable(std::forward<Function>(function)));
+                    invoke = &invoke_heap_callable<Callable>;
+                    manage = &manage_heap_callable<Callable>;
+                }
+            }
+
+            Inplace_function(const Inplace_function& other):
+                invoke{other.invoke},
+                manage{other.manage}
+            {
+                if (manage)
+                    manage(Operation::copy, storage, other.storage);
+                else
+                    std::memcpy(storage, other.storage, Capacity);
+            }
+
+            Inplace_function(Inplace_function&& other) noexcept:
+                invoke{other.invoke},
+                manage{other.manage}
+            {
+                if (manage)
+                    manage(Operation::move, storage, other.storage);
+                else
+                    std::memcpy(storage, other.storage, Capacity);
+                other.reset();
+            }
+
+            Inplace_function& operator=(const Inplace_function& other)
+            {
+                if (this != &other)
+                {
+                    reset();
+                    if (other.manage)
+                        other.manage(Operation::copy, storage, other.storage);
+                    else
+                        std::memcpy(storage, other.storage, Capacity);
+                    invoke = other.invoke;
+                    manage = other.manage;
+                }
+                return *this;
+            }
+
+            Inplace_function& operator=(Inplace_function&& other) noexcept
+            {
+                if (this != &other)
+                {
+                    reset();
+                    if (other.manage)
+                        other.manage(Operation::move, storage, other.storage);
+                    else
+                        std::memcpy(storage, other.storage, Capacity);
+                    invoke = other.invoke;
+                    manage = other.manage;
+                    other.reset();
+                }
+                return *this;
+            }
+
+            Inplace_function& operator=(std::nullptr_t) noexcept
+            {
+                reset();
+                return *this;
+            }
+
+            ~Inplace_function()
+            {
+                reset();
+            }
+
+            /**
+             * @brief Call the function
+             *
+             * @throws std::bad_function_call If the function is empty
+            */
+            Result operator()(Args... args) const
+            {
+                return invoke(storage, std::forward<Args>(args)...);
+            }
+
+            explicit operator bool() const noexcept
+            {
+                return invoke != &invoke_empty;
+            }
+
+        private:
+            enum class Operation
+            {
+                copy,
+                move,
+                destroy
+            };
+
+            using Invoker = Result (*)(void*, Args&&...);
+            using Manager = void (*)(Operation, void*, void*);
+
+            static Result invoke_empty(void*, Args&&...)
+            {
+                throw std::bad_function_call();
+            }
+
+            template <typename Callable>
+            static Result invoke_callable(void* storage, Args&&... args)
+            {
+                if constexpr (std::is_void_v<Result>)
+                    std::invoke(*static_cast<Callable*>(storage), std::forward<Args>(args)...);
+                else
+                    return std::invoke(*static_cast<Callable*>(storage), std::forward<Args>(args)...);
+            }
+
+            template <typename Callable>
+            static Result invoke_heap_callable(void* storage, Args&&... args)
+            {
+                if constexpr (std::is_void_v<Result>)
+                    std::invoke(**static_cast<Callable**>(storage), std::forward<Args>(args)...);
+                else
+                    return std::invoke(**static_cast<Callable**>(storage), std::forward<Args>(args)...);
+            }
+
+            /**
+             * @brief Copy, move or destroy a callable that cannot simply be copied byte by byte
+            */
+            template <typename Callable>
+            static void manage_callable(Operation operation, void* destination, void* source)
+            {
+                static_assert(std::is_nothrow_move_constructible_v<Callable>, "Moving an Inplace_function is noexcept, callables that may throw when moved belong on the heap");
+
+                switch (operation)
+                {
+                    case Operation::copy:
+                        ::new (destination) Callable(*static_cast<const Callable*>(source));
+                        break;
+                    case Operation::move:
+                        ::new (destination) Callable(std::move(*static_cast<Callable*>(source)));
+                        break;
+                    case Operation::destroy:
+                        static_cast<Callable*>(destination)->~Callable();
+                        break;
+                }
+            }
+
+            /**
+             * @brief Copy, move or destroy a callable allocated on the heap, whose pointer is in the buffer
+             *
+             * Moving steals the pointer and leaves the source holding null, which destroying ignores.
+            */
+            template <typename Callable>
+            static void manage_heap_callable(Operation operation, void* destination, void* source)
+            {
+                switch (operation)
+                {
+                    case Operation::copy:
+                        ::new (destination) Callable*(new Callable(**static_cast<Callable* const*>(source)));
+                        break;
+                    case Operation::move:
+                        ::new (destination) Callable*(*static_cast<Callable**>(source));
+                        *static_cast<Callable**>(source) = nullptr;
+                        break;
+                    case Operation::destroy:
+                        delete *static_cast<Callable**>(destination);
+                        break;
+                }
+            }
+
+            void reset() noexcept
+            {
+                if (manage)
+                    manage(Operation::destroy, storage, nullptr);
+                invoke = &invoke_empty;
+                manage = nullptr;
+            }
+
+            /// Mutable like the target of a std::function, left uninitialized since trivial callables copy it whole
+            alignas(std::max_align_t) mutable unsigned char storage[Capacity];
+            Invoker invoke = &invoke_empty;
+            Manager manage = nullptr; ///< Null for trivially copyable callables
+    };
+
+} // namespace gf
@@ -1,23 +1,357 @@
 #pragma once
 
-#include <functional>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Angle.hpp"
+#include "Inplace_function.hpp"
 
 namespace gf
 {
-    using Easing_function = std::function<float(float)>;
+    namespace easing
+    {
+        constexpr float linear(float t)
+        {
+            return t;
+        }
+
+        constexpr float in_quad(float t)
+        {
+            return t * t;
+        }
+
+        constexpr float out_quad(float t)
+        {
+            return t * (2 - t);
+        }
+
+        constexpr float in_out_quad(float t)
+        {
+            return (t < 0.5f) ? 2 * t * t : -1 + (4 - 2 * t) * t;
+        }
+
+        constexpr float in_cubic(float t)
+        {
+            return t * t * t;
+        }
+
+        constexpr float out_cubic(float t)
+        {
+            const float u = t - 1;
+            return u * u * u + 1;
+        }
+
+        constexpr float in_out_cubic(float t)
+        {
+            return (t < 0.5f) ? 4 * t * t * t : (t - 1) * (2 * t - 2) * (2 * t - 2) + 1;
+        }
+
+        constexpr float in_quart(float t)
+        {
+            return t * t * t * t;
+        }
+
+        constexpr float out_quart(float t)
+        {
+            const float u = t - 1;
+            return 1 - u * u * u * u;
+        }
+
+        constexpr float in_out_quart(float t)
+        {
+            const float u = t - 1;
+            return (t < 0.5f) ? 8 * t * t * t * t : 1 - 8 * u * u * u * u;
+        }
+
+        constexpr float in_quint(float t)
+        {
+            return t * t * t * t * t;
+        }
+
+        constexpr float out_quint(float t)
+        {
+            const float u = t - 1;
+            return 1 + u * u * u * u * u;
+        }
+
+        constexpr float in_out_quint(float t)
+        {
+            const float u = t - 1;
+            return (t < 0.5f) ? 16 * t * t * t * t * t : 1 + 16 * u * u * u * u * u;
+        }
+
+        inline float in_sine(float t)
+        {
+            return 1 - std::cos(t * M_PI / 2);
+        }
+
+        inline float out_sine(float t)
+        {
+            return std::sin(t * M_PI / 2);
+        }
+
+        inline float in_out_sine(float t)
+        {
+            return 0.5f * (1 - std::cos(t * M_PI));
+        }
+
+        inline float in_expo(float t)
+        {
+            return (t == 0) ? 0.0f : std::exp2(10 * (t - 1));
+        }
+
+        inline float out_expo(float t)
+        {
+            return (t == 1) ? 1.0f : 1 - std::exp2(-10 * t);
+        }
+
+        inline float in_out_expo(float t)
+        {
+            if (t == 0)
+            {
+                return 0;
+            }
+            if (t == 1)
+            {
+                return 1;
+            }
+            if (t < 0.5f)
+            {
+                return 0.5f * std::exp2(20 * t - 10);
+            }
+            else
+            {
+                return 1 - 0.5f * std::exp2(-20 * t + 10);
+            }
+        }
+
+        inline float in_circ(float t)
+        {
+            return 1 - std::sqrt(1 - t * t);
+        }
+
+        inline float out_circ(float t)
+        {
+            return std::sqrt((2 - t) * t);
+        }
+
+        inline float in_out_circ(float t)
+        {
+            if (t < 0.5f)
+            {
+                return 0.5f * (1 - std::sqrt(1 - 4 * t * t));
+            }
+            else
+            {
+                return 0.5f * (std::sqrt(-((2 * t - 3) * (2 * t - 1))) + 1);
+            }
+        }
+    } // namespace easing
+
+    /**
+     * @brief Names the built in easing functions, so they can be stored compactly and evaluated in batches
+    */
+    enum class Easing_type : std::uint8_t
+    {
+        linear,
+        in_quad,
+        out_quad,
+        in_out_quad,
+        in_cubic,
+        out_cubic,
+        in_out_cubic,
+        in_quart,
+        out_quart,
+        in_out_quart,
+        in_quint,
+        out_quint,
+        in_out_quint,
+        in_sine,
+        out_sine,
+        in_out_sine,
+        in_expo,
+        out_expo,
+        in_out_expo,
+        in_circ,
+        out_circ,
+        in_out_circ
+    };
+
+    constexpr std::size_t easing_type_count = static_cast<std::size_t>(Easing_type::in_out_circ) + 1;
+
+    #define GF_EASING_TYPES(CASE) \
+        CASE(linear) CASE(in_quad) CASE(out_quad) CASE(in_out_quad) \
+        CASE(in_cubic) CASE(out_cubic) CASE(in_out_cubic) \
+        CASE(in_quart) CASE(out_quart) CASE(in_out_quart) \
+        CASE(in_quint) CASE(out_quint) CASE(in_out_quint) \
+        CASE(in_sine) CASE(out_sine) CASE(in_out_sine) \
+        CASE(in_expo) CASE(out_expo) CASE(in_out_expo) \
+        CASE(in_circ) CASE(out_circ) CASE(in_out_circ)
+
+    namespace easing
+    {
+        /**
+         * @brief Evaluate a built in easing function
+         *
+         * When the type is known at compile time the switch folds away to a direct call.
+        */
+        inline float evaluate(Easing_type type, float t)
+        {
+            switch (type)
+            {
+                #define GF_EASING_CASE(name) case Easing_type::name: return easing::name(t);
+                GF_EASING_TYPES(GF_EASING_CASE)
+                #undef GF_EASING_CASE
+            }
+            return t;
+        }
+
+        /**
+         * @brief Evaluate a built in easing function over an array
+         *
+         * The type is dispatched once for the whole array, to the matching easing::batch function.
+         *
+         * @param type The easing function
+         * @param t The normalized times
+         * @param result The eased times, may alias t
+         * @param count The number of times
+        */
+        void evaluate(Easing_type type, const float* t, float* result, std::size_t count);
+
+        /**
+         * @brief Array versions of the easing functions, vectorized with SSE2, AVX2 or NEON where available
+         *
+         * Each takes normalized times in [0, 1] and writes the eased times, result may alias t. The
+         * in_out variants blend both halves without branching, and the sine and expo variants use
+         * polynomial approximations accurate to a few ulp instead of the standard library.
+        */
+        namespace batch
+        {
+            #define GF_EASING_BATCH_DECLARATION(name) void name(const float* t, float* result, std::size_t count);
+            GF_EASING_TYPES(GF_EASING_BATCH_DECLARATION)
+            #undef GF_EASING_BATCH_DECLARATION
+        } // namespace batch
+    } // namespace easing
+
+    /**
+     * @brief A built in easing function chosen at compile time
+     *
+     * Use it as the easing parameter of lerp or Linear_process to have the easing inlined.
+    */
+    template <Easing_type Type>
+    struct Static_easing
+    {
+        static constexpr Easing_type type = Type;
+
+        float operator()(float t) const
+        {
+            return easing::evaluate(Type, t);
+        }
+    };
+
+    /**
+     * @brief An easing function stored by value
+     *
+     * Built in easing functions, whether given as an Easing_type or as one of the easing:: functions,
+     * are stored as their type and evaluated through a switch the compiler can inline. Any other
+     * callable taking and returning a float is stored in an Inplace_function and called indirectly,
+     * so copying an easing function only allocates for callables over 32 bytes.
+    */
+    class Easing_function
+    {
+        public:
+            /**
+             * @brief Construct a built in easing function, linear by default
+            */
+            Easing_function(Easing_type type = Easing_type::linear):
+                type{type}
+            {}
+
+            template <Easing_type Type>
+            Easing_function(Static_easing<Type>):
+                type{Type}
+            {}
+
+            /**
+             * @brief Construct an easing function from a function pointer, recognising the built in ones
+            */
+            Easing_function(float (*function)(float)):
+                type{Easing_type::linear},
+                custom{function}
+            {
+                #define GF_EASING_CASE(name) if (function == &easing::name) { type = Easing_type::name; custom = nullptr; return; }
+                GF_EASING_TYPES(GF_EASING_CASE)
+                #undef GF_EASING_CASE
+            }
+
+            /**
+             * @brief Construct a custom easing function from any callable taking and returning a float
+            */
+            template <typename Function, typename = std::enable_if_t<
+                std::is_invocable_r_v<float, Function&, float>
+                && !std::is_same_v<std::decay_t<Function>, Easing_function>>>
+            Easing_function(Function function):
+                type{Easing_type::linear}
+            {
+                if constexpr (std::is_convertible_v<Function, float (*)(float)>)
+                    *this = Easing_function(static_cast<float (*)(float)>(function));
+                else
+                    custom = std::move(function);
+            }
+
+            float operator()(float t) const
+            {
+                return custom ? custom(t) : easing::evaluate(type, t);
+            }
+
+            /**
+             * @brief Get whether this is a custom function rather than a built in one
+            */
+            bool is_custom() const
+            {
+                return static_cast<bool>(custom);
+            }
+
+            /**
+             * @brief Get the built in easing function, only meaningful if this is not custom
+            */
+            Easing_type get_type() const
+            {
+                return type;
+            }
+
+        private:
+            Easing_type type; ///< The built in function, if there is no custom one
+            Inplace_function<float(float)> custom; ///< The custom function, empty for built in ones
+    };
+
+    namespace easing
+    {
+        /**
+         * @brief Get a built in easing function as an Easing_function
+        */
+        inline Easing_function get_function(Easing_type type)
+        {
+            return Easing_function(type);
+        }
+    } // namespace easing
 
     /**
      * @brief Linearly interpolates between two values
-     * 
+     *
      * @tparam T The type of the values to interpolate, can be any type that supports the +, -, and * operators
+     * @tparam Easing The type of the easing function, a Static_easing or a function type makes the call direct
      * @param start_point The starting value
      * @param end_point The ending value
      * @param normalized_time The normalized time between the start and end points
      * @param easing_function The easing function to use
     */
-    template <typename T>
-    T lerp(const T& start_point, const T& end_point, const float normalized_time, const Easing_function& easing_function = easing::linear)
-    {   
+    template <typename T, typename Easing = Static_easing<Easing_type::linear>>
+    T lerp(const T& start_point, const T& end_point, const float normalized_time, const Easing& easing_function = Easing{})
+    {
         if (normalized_time > 1.0f || normalized_time < 0.0f)
         {
             throw std::invalid_argument("Normalized time must be between 0.0 and 1.0");
@@ -25,30 +359,4 @@ namespace gf
         return start_point + (end_point - start_point) * easing_function(normalized_time);
     }
 
-    namespace easing
-    {
-        float linear(float t);
-        float in_quad(float t);
-        float out_quad(float t);
-        float in_out_quad(float t);
-        float in_cubic(float t);
-        float out_cubic(float t);
-        float in_out_cubic(float t);
-        float in_quart(float t);
-        float out_quart(float t);
-        float in_out_quart(float t);
-        float in_quint(float t);
-        float out_quint(float t);
-        float in_out_quint(float t);
-        float in_sine(float t);
-        float out_sine(float t);
-        float in_out_sine(float t);
-        float in_expo(float t);
-        float out_expo(float t);
-        float in_out_expo(float t);
-        float in_circ(float t);
-        float out_circ(float t);
-        float in_out_circ(float t);
-    } // namespace easing
-
-}; // namespace gf
\ No newline at end of file
+}; // namespace gf
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace gf
+{
+    /**
+     * @brief Counts the jobs of a batch that have not finished yet
+     *
+     * A counter is passed to Job_system::run for every job of a batch and then waited on with
+     * Job_system::wait. The first exception thrown by a job of the batch is rethrown by wait.
+    */
+    class Job_counter
+    {
+        public:
+            /**
+             * @brief Check whether every job counted by this counter has finished
+            */
+            bool get_finished() const
+            {
+                return pending.load(std::memory_order_acquire) == 0;
+            }
+
+        private:
+            friend class Job_system;
+
+            std::atomic<std::size_t> pending{0}; ///< The number of unfinished jobs
+            std::atomic<bool> failed{false}; ///< Whether a job has stored an exception
+            std::exception_ptr exception; ///< The first exception thrown by a job
+    };
+
+    /**
+     * @brief A work-stealing job scheduler
+     *
+     * Every worker thread owns a queue. Jobs are pushed to and popped from the back of the queue
+     * of the thread that created them, which keeps recently spawned work hot in cache, and idle
+     * workers steal from the front of the other queues. Threads that wait on a counter execute
+     * jobs while they wait, so jobs may spawn and wait on nested batches without deadlocking.
+    */
+    class Job_system
+    {
+        public:
+            using Job = std::function<void()>;
+
+            /**
+             * @brief Construct a new Job system and start its worker threads
+             *
+             * @param worker_count The number of worker threads, the thread calling wait also runs jobs
+            */
+            explicit Job_system(std::size_t worker_count = default_worker_count());
+
+            Job_system(const Job_system&) = delete;
+            Job_system& operator=(const Job_system&) = delete;
+
+            /**
+             * @brief Stop the workers, jobs that have not started are discarded
+            */
+            ~Job_system();
+
+            /**
+             * @brief Queue a job
+             *
+             * @param counter The counter of the batch the job belongs to
+             * @param job The job to run
+            */
+            void run(Job_counter& counter, Job job);
+
+            /**
+             * @brief Run jobs until every job counted by the counter has finished
+             *
+             * @param counter The counter to wait on
+            */
+            void wait(Job_counter& counter);
+
+            /**
+             * @brief Split the range [0, count) into chunks and run them in parallel
+             *
+             * The calling thread runs the first chunk itself and returns once every chunk has finished.
+             *
+             * @param count The number of items
+             * @param grain_size The maximum number of items in a chunk
+             * @param function Called with the begin and end of each chunk
+            */
+            template <typename Function>
+            void parallel_for(std::size_t count, std::size_t grain_size, const Function& function)
+            {
+                if (grain_size == 0)
+                    grain_size = 1;
+
+                if (count <= grain_size)
+                {
+                    if (count > 0)
+                        function(std::size_t{0}, count);
+                    return;
+                }
+
+                Job_counter counter;
+                for (std::size_t begin = grain_size; begin < count; begin += grain_size)
+                {
+                    std::size_t end = (count - begin < grain_size) ? count : begin + grain_size;
+                    run(counter, [&function, begin, end]() { function(begin, end); });
+                }
+
+                try
+                {
+                    function(std::size_t{0}, grain_size);
+                }
+                catch (...)
+                {
+                    // The chunks capture the function by reference, so they must finish first
+                    wait_for_all(counter);
+                    throw;
+                }
+                wait(counter);
+            }
+
+            /**
+             * @brief Get the number of worker threads
+            */
+            std::size_t get_worker_count() const;
+
+            /**
+             * @brief Get the number of hardware threads minus the calling thread
+            */
+            static std::size_t default_worker_count();
+
+        private:
+            struct Job_entry
+            {
+                Job job;
+                Job_counter* counter;
+            };
+
+            struct Queue
+            {
+                std::mutex mutex;
+                std::deque<Job_entry> jobs;
+            };
+
+            void worker_loop(std::size_t queue_index);
+            bool try_run_one(std::size_t queue_index);
+            bool try_pop(std::size_t queue_index, Job_entry& entry);
+            bool try_steal(std::size_t thief_index, Job_entry& entry);
+            void execute(Job_entry& entry);
+            void wait_for_all(Job_counter& counter);
+            std::size_t get_queue_index() const;
+
+            std::vector<std::unique_ptr<Queue>> queues; ///< One queue per worker, the last one is shared by other threads
+            std::vector<std::thread> workers;
+
+            std::mutex sleep_mutex;
+            std::condition_variable wake_condition;
+            std::atomic<std::size_t> queued_jobs{0};
+            std::atomic<bool> stopping{false};
+    };
+
+} // namespace gf
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Vector2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief A 2D affine transform as a 2x3 matrix
+     *
+     * A point p maps to x_axis * p.x + y_axis * p.y + origin, so transforming a point is two
+     * multiply adds per component. Matrices compose exactly, including the shear that a rotation
+     * under a non uniform scale produces, which a Transform2 cannot represent.
+    */
+    struct Matrix2x3
+    {
+        /**
+         * @brief Transform a point, applying the translation
+        */
+        Vector2f transform_point(const Vector2f& point) const
+        {
+            return Vector2f(
+                x_axis.x * point.x + y_axis.x * point.y + origin.x,
+                x_axis.y * point.x + y_axis.y * point.y + origin.y
+            );
+        }
+
+        /**
+         * @brief Transform a direction or offset, ignoring the translation
+        */
+        Vector2f transform_vector(const Vector2f& vector) const
+        {
+            return Vector2f(
+                x_axis.x * vector.x + y_axis.x * vector.y,
+                x_axis.y * vector.x + y_axis.y * vector.y
+            );
+        }
+
+        /**
+         * @brief Compose two matrices, the result applies other first and then this
+        */
+        Matrix2x3 operator*(const Matrix2x3& other) const
+        {
+            return Matrix2x3{transform_vector(other.x_axis), transform_vector(other.y_axis), transform_point(other.origin)};
+        }
+
+        bool operator==(const Matrix2x3& other) const
+        {
+            return x_axis == other.x_axis && y_axis == other.y_axis && origin == other.origin;
+        }
+
+        bool operator!=(const Matrix2x3& other) const
+        {
+            return !(*this == other);
+        }
+
+        Vector2f x_axis{1.0f, 0.0f}; ///< Where the matrix takes (1, 0), less the origin
+        Vector2f y_axis{0.0f, 1.0f}; ///< Where the matrix takes (0, 1), less the origin
+        Vector2f origin; ///< Where the matrix takes (0, 0)
+    };
+} // namespace gf
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace gf
+{
+    /**
+     * @brief A pool of objects of one type allocated from fixed size chunks
+     *
+     * Objects never move once created. Destroyed slots are reused before new slots are taken from
+     * the chunks, and chunks are only returned to the heap when the pool is released, so spawning
+     * and despawning objects does not touch the heap once the pool has grown to its working size.
+     *
+     * @tparam T The type of the pooled objects
+     * @tparam Chunk_size The number of objects per chunk
+    */
+    template <typename T, std::size_t Chunk_size = 256>
+    class Object_pool
+    {
+        public:
+            Object_pool() = default;
+            Object_pool(const Object_pool&) = delete;
+            Object_pool& operator=(const Object_pool&) = delete;
+
+            ~Object_pool()
+            {
+                clear();
+            }
+
+            /**
+             * @brief Construct an object in the pool
+             *
+             * @param args The arguments to construct the object with
+             * @return The new object
+            */
+            template <typename... Args>
+            T* create(Args&&... args)
+            {
+                Slot* slot = allocate();
+                T* object;
+                try
+                {
+                    object = new (slot->storage) T(std::forward<Args>(args)...);
+                }
+                catch (...)
+                {
+                    slot->live = false;
+                    slot->next = free_list;
+                    free_list = slot;
+                    throw;
+                }
+
+                slot->live = true;
+                ++live_count;
+                return object;
+            }
+
+            /**
+             * @brief Destroy an object created by this pool and make its slot available again
+            */
+            void destroy(T* object)
+            {
+                object->~T();
+
+                Slot* slot = reinterpret_cast<Slot*>(object);
+                slot->live = false;
+                slot->next = free_list;
+                free_list = slot;
+                --live_count;
+            }
+
+            /**
+             * @brief Check whether an object was allocated from this pool
+            */
+            bool owns(const void* object) const
+            {
+                auto address = reinterpret_cast<std::uintptr_t>(object);
+                for (const auto& chunk : chunks)
+                {
+                    auto first = reinterpret_cast<std::uintptr_t>(chunk.get());
+                    if (address >= first && address < first + sizeof(Slot) * Chunk_size)
+                        return true;
+                }
+                return false;
+            }
+
+            /**
+             * @brief Call a function with every live object
+            */
+            template <typename Function>
+            void for_each(const Function& function)
+            {
+                for (std::size_t chunk = 0; chunk < chunks.size() && chunk <= current_chunk; ++chunk)
+                {
+                    std::size_t end = (chunk == current_chunk) ? current_slot : Chunk_size;
+                    for (std::size_t slot = 0; slot < end; ++slot)
+                    {
+                        if (chunks[chunk][slot].live)
+                            function(*reinterpret_cast<T*>(chunks[chunk][slot].storage));
+                    }
+                }
+            }
+
+            /**
+             * @brief Destroy every object at once, keeping the chunks for reuse
+             *
+             * The free list is discarded and slots are handed out from the first chunk again, so
+             * this is constant time unless the objects have a non-trivial destructor to run.
+            */
+            void clear()
+            {
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    for_each([](T& object) { object.~T(); });
+                }
+
+                // Live flags below the next unused slot are rewritten as slots are handed out again
+                free_list = nullptr;
+                current_chunk = 0;
+                current_slot = 0;
+                live_count = 0;
+            }
+
+            /**
+             * @brief Destroy every object and return the chunks to the heap
+            */
+            void release()
+            {
+                clear();
+                chunks.clear();
+            }
+
+            /**
+             * @brief Get the number of live objects
+            */
+            std::size_t size() const
+            {
+                return live_count;
+            }
+
+        private:
+            struct Slot
+            {
+                union
+                {
+                    Slot* next; ///< The next free slot, while the slot is free
+                    alignas(T) unsigned char storage[sizeof(T)]; ///< The object, while the slot is live
+                };
+                bool live;
+            };
+
+            using Chunk = std::unique_ptr<Slot[]>;
+
+            Slot* allocate()
+            {
+                if (free_list)
+                {
+                    Slot* slot = free_list;
+                    free_list = slot->next;
+                    return slot;
+                }
+
+                if (current_slot == Chunk_size)
+                {
+                    ++current_chunk;
+                    current_slot = 0;
+                }
+
+                if (current_chunk == chunks.size())
+                {
+                    chunks.push_back(std::make_unique<Slot[]>(Chunk_size));
+                }
+
+                return &chunks[current_chunk][current_slot++];
+            }
+
+            std::vector<Chunk> chunks;
+            Slot* free_list = nullptr;
+            std::size_t current_chunk = 0; ///< The chunk new slots are taken from
+            std::size_t current_slot = 0; ///< The next unused slot of the current chunk
+            std::size_t live_count = 0;
+    };
+
+} // namespace gf
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "Game_object.hpp"
+#include "Spline_path.hpp"
+#include "Time.hpp"
+#include "Vector2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief Moves many game objects along one path with a single batched update
+     *
+     * Followers are stored in struct of arrays form. An update advances every distance in one
+     * loop, evaluates all the points with one call to Spline_path::get_points_at_distances, then
+     * writes the transforms. Followers whose objects have been destroyed are dropped by the update.
+     *
+     * The path must outlive the group.
+    */
+    class Path_follower_group
+    {
+        public:
+            /**
+             * @brief Construct an empty group
+             *
+             * @param path The path every follower moves along
+             * @param loop Whether followers start again from the beginning after reaching the end, otherwise they stay there
+             * @param orient Whether followers are rotated to face along the path
+            */
+            explicit Path_follower_group(const Spline_path& path, bool loop = false, bool orient = false);
+
+            /**
+             * @brief Add a follower
+             *
+             * @param object The object to move
+             * @param speed The distance to move along the path per second, negative to move back towards the start
+             * @param start_distance The distance along the path to start from
+            */
+            void add(Game_object& object, float speed, float start_distance = 0.0f);
+
+            /**
+             * @brief Stop moving an object, does nothing if it is not in the group
+            */
+            void remove(const Game_object& object);
+
+            /**
+             * @brief Advance every follower and write the transforms of their objects
+            */
+            void update(const Time& dt);
+
+            std::size_t size() const;
+
+            void clear();
+
+        private:
+            void remove_at(std::size_t index);
+
+            const Spline_path* path;
+            bool loop;
+            bool orient;
+            std::vector<Game_object_handle> objects;
+            std::vector<float> distances;
+            std::vector<float> speeds;
+            std::vector<Vector2f> points;
+            std::vector<Vector2f> directions;
+    };
+
+} // namespace gf
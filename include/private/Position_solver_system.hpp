@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Game_object.hpp"
+#include "Handle.hpp"
+#include "Interpolation.hpp"
+#include "Time.hpp"
+#include "Transform2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief Moves many game objects towards target transforms with one batched update
+     *
+     * Each move does what a Position_solver with a target position does: it interpolates the
+     * object's transform from where it was when the move started to the target, taking the
+     * shortest path for the rotation, and writes it every update until the target is reached.
+     * Instead of a component update per object, moves are stored in struct of arrays form, one
+     * bucket per easing type. An update advances a whole bucket with a few loops the compiler can
+     * vectorize, one batched easing evaluation and one batched interpolation per component, then
+     * scatters the results into the objects in a separate pass.
+     *
+     * Only objects whose transform actually changes are written, and so marked dirty. A move is
+     * removed by the update that finishes it, or when its object is destroyed, and an object has
+     * at most one move at a time.
+    */
+    class Position_solver_system
+    {
+        public:
+            struct Solver;
+            using Solver_handle = Handle<Solver>;
+
+            /**
+             * @brief Start moving an object from its current transform to a target, replacing any move it already has
+            */
+            Solver_handle move(Game_object& object, const Transform2& target, const Time& duration, Easing_type easing = Easing_type::linear);
+
+            /**
+             * @brief Stop a move where it is, does nothing if the handle is stale
+            */
+            void stop(Solver_handle solver);
+
+            /**
+             * @brief Stop the move of an object where it is, does nothing if it has none
+            */
+            void stop(const Game_object& object);
+
+            /**
+             * @brief Check whether a move is still running
+            */
+            bool contains(Solver_handle solver) const;
+
+            /**
+             * @brief Get how far a move is through its duration, in [0, 1]
+             *
+             * @throws std::out_of_range If the handle is stale
+            */
+            float get_progress(Solver_handle solver) const;
+
+            /**
+             * @brief Advance every move, write the transforms that changed and remove the finished moves
+            */
+            void update(const Time& dt);
+
+            /**
+             * @brief Get the number of running moves
+            */
+            std::size_t size() const;
+
+            /**
+             * @brief Stop every move
+            */
+            void clear();
+
+        private:
+            static constexpr std::size_t component_count = 5; ///< Position x and y, rotation, scale x and y
+
+            /**
+             * @brief The moves with the same easing, one row each
+            */
+            struct Bucket
+            {
+                std::vector<float> elapsed;
+                std::vector<float> length;
+                std::array<std::vector<float>, component_count> start;
+                std::array<std::vector<float>, component_count> end;
+                std::vector<Game_object_handle> objects;
+                std::vector<Solver_handle> owners; ///< The solver of each row
+            };
+
+            struct Record
+            {
+                Easing_type easing;
+                std::uint32_t row; ///< The index of the move in its bucket
+            };
+
+            void remove_row(Bucket& bucket, std::size_t row);
+
+            std::array<Bucket, easing_type_count> buckets;
+            Slot_table<Solver, Record> records;
+            std::unordered_map<std::uint64_t, Solver_handle> solvers_by_object; ///< Keyed by the value of the object's handle
+            std::vector<float> progress;
+            std::array<std::vector<float>, component_count> values; ///< Scratch for the interpolated components of a bucket
+            std::vector<std::uint32_t> finished_rows;
+    };
+
+} // namespace gf
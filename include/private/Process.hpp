@@ -5,16 +5,20 @@
 #include "Angle.hpp"
 #include "Vector2.hpp"
 #include "Transform2.hpp"
+#include "Profiler.hpp"
 
 
 namespace gf
 {
+    class Easing_table;
+
     /**
      * @brief A linear process for interpolating between two values
      * 
      * @tparam T The type of the values to interpolate. Can be any type that supports the +, -, and * operators
+     * @tparam Easing The type of the easing function, a Static_easing fixes the easing at compile time
     */
-    template <typename T>
+    template <typename T, typename Easing = Easing_function>
     class Linear_process
     {
         public:
@@ -26,11 +30,11 @@ namespace gf
              * @param length The length of the process
              * @param easing The easing function to use
             */
-            Linear_process(const T& start, const T& end, const Time& length, const Easing_function& easing = easing::linear):
+            Linear_process(const T& start, const T& end, const Time& length, Easing easing = Easing{}):
                 start{start}, 
                 end{end},
                 clock{length},
-                easing{easing}
+                easing{std::move(easing)}
             {}
 
             /**
@@ -88,6 +92,7 @@ namespace gf
             */
             void update(const Time& dt)
             {
+                GF_PROFILE_SCOPE("Linear_process::update");
                 clock.tick(dt);
             }
 
@@ -129,14 +134,14 @@ namespace gf
                 if (clock.get_finished())
                     return end;
                 else
-                    return gf::lerp(start, end, clock.get_normalized_progress());
+                    return gf::lerp(start, end, clock.get_normalized_progress(), easing);
             }
 
         private:
             T start; ///< The starting value
             T end; ///< The ending value
             Clock clock; ///< The clock for the process
-            const Easing_function& easing; ///< The easing function to use
+            Easing easing; ///< The easing function to use
     };
 
     /**
@@ -156,16 +161,26 @@ namespace gf
              * @param length The length of the process
              * @param easing The easing function to use
             */
-            Angular_linear_process(Angle start, Angle end, const Time& length, const Easing_function& easing = easing::linear): 
-                Linear_process<gf::Angle>(start.get_mod(TWO_PI), end.get_mod(TWO_PI), length, easing) 
+            Angular_linear_process(Angle start, Angle end, const Time& length, Easing_function easing = Easing_type::linear): 
+                Linear_process<gf::Angle>(start, end, length, std::move(easing)) 
             {
-                if (get_start() - get_end() > gf::PI)
-                    set_end(get_end() + gf::TWO_PI);
-                if (get_start() - get_end() < -gf::PI)
-                    set_end(get_end() - gf::TWO_PI);
+                float start_radians = start.get_radians();
+                float end_radians = end.get_radians();
+                wrap_shortest_path(start_radians, end_radians);
+                set_start(Angle(start_radians));
+                set_end(Angle(end_radians));
             }
     };
 
+    /**
+     * @brief A linear process for transforms
+     *
+     * Position, rotation and scale share one elapsed time and one easing evaluation per sample,
+     * and the rotation takes the shortest path like an Angular_linear_process. The start and end
+     * values and the timing are plain floats stored inline, and the easing is a built in type or
+     * a pointer to an Easing_table, so processes are 64 bytes, can be kept by value in large arrays
+     * and updating one never allocates.
+    */
     class Transform_linear_process
     {
         public:
@@ -175,8 +190,19 @@ namespace gf
              * @param start The starting transform
              * @param end The ending transform
              * @param length The length of the process
+             * @param easing The built in easing function to use
+            */
+            Transform_linear_process(const Transform2& start, const Transform2& end, const Time& length, Easing_type easing = Easing_type::linear);
+
+            /**
+             * @brief Construct a new Transform linear process object eased by a sampled easing function
+             * 
+             * @param start The starting transform
+             * @param end The ending transform
+             * @param length The length of the process
+             * @param easing_table The sampled easing function to use, which must outlive the process
             */
-            Transform_linear_process(const Transform2& start, const Transform2& end, const Time& length, const Easing_function &easing_function = easing::linear);
+            Transform_linear_process(const Transform2& start, const Transform2& end, const Time& length, const Easing_table& easing_table);
 
             /**
              * @brief Reset the process
@@ -212,11 +238,14 @@ namespace gf
             void set_length(const Time& new_length);
 
             /**
-             * @brief Get the length of the process
+             * @brief Advance the process
              * 
-             * @return Time The length of the process
+             * @param dt The time to advance by
             */
-            void update(const Time& dt);
+            void update(const Time& dt)
+            {
+                elapsed += dt.get_milliseconds();
+            }
 
             /**
              * @brief Finish the process
@@ -224,11 +253,12 @@ namespace gf
             void finish();
 
             /**
-             * @brief Get the current position of the process
-             * 
-             * @return T The current position
+             * @brief Get whether the process has reached its end
             */
-            bool get_finished() const;
+            bool get_finished() const
+            {
+                return elapsed >= length;
+            }
 
             /**
              * @brief Get the starting transform of the process
@@ -236,20 +266,26 @@ namespace gf
             Transform2 get_start() const;
 
             /**
-             * @brief Get the ending transform of the process
+             * @brief Get the ending transform of the process, with the rotation on the shortest path from the start
             */
             Transform2 get_end() const;
 
             /**
-             * @brief Get the current position of the process
-             * 
-             * @return T The current position
+             * @brief Get the current transform of the process
             */
             Transform2 get() const;
 
         private:
-            Linear_process<gf::Vector2f> position; ///< The linear process for the position
-            Angular_linear_process rotation; ///< The angular linear process for the rotation
+            Vector2f start_position;
+            Vector2f end_position;
+            Vector2f start_scale;
+            Vector2f end_scale;
+            float start_rotation; ///< In radians
+            float end_rotation; ///< In radians
+            float elapsed; ///< In milliseconds
+            float length; ///< In milliseconds
+            const Easing_table* easing_table; ///< The sampled easing function, or nullptr to use easing
+            Easing_type easing; ///< The built in easing function, if there is no table
     };
 
 } // namespace gf
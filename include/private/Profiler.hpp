@@ -0,0 +1,90 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "Trace.hpp"
+
+namespace gf::profiling
+{
+    /**
+     * @brief The calls and time recorded under one name
+    */
+    struct Profile_entry
+    {
+        const char* name; ///< The name the time was recorded under
+        std::uint64_t calls; ///< The number of calls
+        std::uint64_t nanoseconds; ///< The total time spent in the calls
+    };
+
+    /**
+     * @brief Record one call
+     *
+     * Each thread records into its own fixed size buffer without locking. The name is used as
+     * the key by address, so it must outlive the program, like a string literal or a type name.
+     *
+     * @param name The name to record the call under
+     * @param nanoseconds The duration of the call
+    */
+    void record(const char* name, std::uint64_t nanoseconds);
+
+    /**
+     * @brief Aggregate what every thread recorded since the previous call
+     *
+     * Meant to be called once per frame, from one thread at a time. Entries are sorted by total
+     * time, longest first. While a trace is running this also marks the end of the frame in it.
+     *
+     * @return The calls and time per name since the previous call
+    */
+    std::vector<Profile_entry> end_frame();
+
+    /**
+     * @brief Aggregate what every thread recorded since the program started
+    */
+    std::vector<Profile_entry> get_totals();
+
+    /**
+     * @brief Print a table of entries
+    */
+    void dump(std::ostream& os, const std::vector<Profile_entry>& entries);
+
+    /**
+     * @brief Records the time between its construction and destruction, and traces it while a trace is running
+    */
+    class Scoped_timer
+    {
+        public:
+            explicit Scoped_timer(const char* name):
+                name{name},
+                start{std::chrono::steady_clock::now()}
+            {}
+
+            Scoped_timer(const Scoped_timer&) = delete;
+            Scoped_timer& operator=(const Scoped_timer&) = delete;
+
+            ~Scoped_timer()
+            {
+                auto end = std::chrono::steady_clock::now();
+                record(name, static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+                if (is_tracing())
+                    trace_complete(name, start, end);
+            }
+
+        private:
+            const char* name;
+            std::chrono::steady_clock::time_point start;
+    };
+
+} // namespace gf::profiling
+
+/**
+ * @brief Time the rest of the enclosing scope under a name
+ *
+ * Compiles to nothing unless the library is built with USE_PROFILING.
+*/
+#ifdef GF_USING_PROFILING
+    #define GF_PROFILE_SCOPE(name) ::gf::profiling::Scoped_timer GF_PROFILE_CONCAT(gf_profile_scope_, __LINE__){name}
+#else
+    #define GF_PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "Transform2.hpp"
+#include "Vector2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief Flat storage for a transform hierarchy
+     *
+     * Local transforms, global transforms, anchor points and parent indices are kept in parallel
+     * arrays ordered depth-first, so every parent is stored before its children and the global
+     * pass is a single linear sweep. Nodes are referred to by stable ids which are mapped to their
+     * current row, since rows are reordered whenever the structure of the hierarchy changes.
+    */
+    class Scene_graph
+    {
+        public:
+            using Node_id = std::uint32_t;
+
+            static constexpr Node_id null_node = std::numeric_limits<Node_id>::max(); ///< Id of no node, used for roots
+
+            /**
+             * @brief Create a new node with an identity transform
+             *
+             * @param parent The parent of the new node, or null_node to create a root
+             * @return The id of the new node
+            */
+            Node_id create_node(Node_id parent = null_node);
+
+            /**
+             * @brief Destroy a node, its children become roots
+             *
+             * @param node The node to destroy
+            */
+            void destroy_node(Node_id node);
+
+            /**
+             * @brief Attach a node to a new parent
+             *
+             * @param node The node to move
+             * @param parent The new parent, or null_node to make the node a root
+            */
+            void set_parent(Node_id node, Node_id parent);
+
+            Node_id get_parent(Node_id node) const;
+
+            const Transform2& get_local_transform(Node_id node) const;
+            void set_local_transform(Node_id node, const Transform2& transform);
+
+            const Vector2f& get_anchor_point(Node_id node) const;
+            void set_anchor_point(Node_id node, const Vector2f& anchor_point);
+
+            /**
+             * @brief Get the global transform of a node as of the last call to update_transforms
+            */
+            const Transform2& get_global_transform(Node_id node) const;
+
+            /**
+             * @brief Get the global transform of a node as of the last call to store_previous_transforms
+            */
+            const Transform2& get_previous_global_transform(Node_id node) const;
+
+            /**
+             * @brief Copy the global transform of every node to its previous global transform
+             *
+             * Called before each fixed simulation step so that rendering can interpolate between the
+             * previous and current steps.
+            */
+            void store_previous_transforms();
+
+            /**
+             * @brief Copy the global transform of one node to its previous global transform
+            */
+            void store_previous_transform(Node_id node);
+
+            /**
+             * @brief Mark a node as changed so that its subtree is recomputed on the next update
+             *
+             * Different nodes may be marked, and have their local transforms set, from different threads.
+            */
+            void mark_dirty(Node_id node);
+
+            /**
+             * @brief Restore depth-first order if the structure changed, then recompute the
+             * global transforms of every dirty subtree in one pass over the arrays
+            */
+            void update_transforms();
+
+            /**
+             * @brief Get the number of live nodes
+            */
+            std::size_t size() const;
+
+        private:
+            static constexpr std::uint32_t null_row = std::numeric_limits<std::uint32_t>::max();
+
+            std::uint32_t row_of(Node_id node) const;
+            void linearize();
+            void compute_row(std::uint32_t row);
+            bool is_descendant(std::uint32_t row, std::uint32_t ancestor_row) const;
+
+            /* Rows, in depth-first order */
+            std::vector<Transform2> local_transforms;
+            std::vector<Transform2> global_transforms;
+            std::vector<Transform2> previous_global_transforms;
+            std::vector<Transform2> child_anchors; ///< The global transform children of a row are attached to
+            std::vector<Vector2f> anchor_points;
+            std::vector<std::uint32_t> parent_rows;
+            std::vector<std::uint8_t> dirty_rows;
+            std::vector<Node_id> row_nodes; ///< The node stored in each row, null_node for destroyed rows
+
+            /* Node ids */
+            std::vector<std::uint32_t> node_rows; ///< The row of each node id
+            std::vector<Node_id> free_nodes;
+
+            std::size_t dead_rows = 0;
+            bool order_dirty = false;
+            std::atomic<bool> transforms_dirty{false}; ///< Set when any row is dirty, possibly from several threads
+    };
+
+} // namespace gf
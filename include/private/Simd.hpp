@@ -0,0 +1,249 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief The widest instruction set the translation unit is compiled for
+ *
+ * AVX2 is used only when the compiler targets it, see the USE_AVX2 option. Defining
+ * GF_SIMD_DISABLE forces the scalar fallback.
+*/
+#if defined(GF_SIMD_DISABLE)
+    #define GF_SIMD_SCALAR
+#elif defined(__AVX2__) && defined(__FMA__)
+    #define GF_SIMD_AVX2
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GF_SIMD_SSE2
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define GF_SIMD_NEON
+    #include <arm_neon.h>
+#else
+    #define GF_SIMD_SCALAR
+#endif
+
+namespace gf::simd
+{
+    /**
+     * @brief A pack of floats processed by one instruction
+     *
+     * Only meant for kernels in source files, which loop over arrays a pack at a time. The lane
+     * count depends on the instruction set the file is compiled for.
+    */
+    struct Float_pack
+    {
+        #if defined(GF_SIMD_AVX2)
+            static constexpr std::size_t width = 8;
+            __m256 value;
+        #elif defined(GF_SIMD_SSE2)
+            static constexpr std::size_t width = 4;
+            __m128 value;
+        #elif defined(GF_SIMD_NEON)
+            static constexpr std::size_t width = 4;
+            float32x4_t value;
+        #else
+            static constexpr std::size_t width = 1;
+            float value;
+        #endif
+    };
+
+    /**
+     * @brief The result of comparing packs, a lane is set where the comparison holds
+    */
+    struct Mask_pack
+    {
+        #if defined(GF_SIMD_AVX2)
+            __m256 value;
+        #elif defined(GF_SIMD_SSE2)
+            __m128 value;
+        #elif defined(GF_SIMD_NEON)
+            uint32x4_t value;
+        #else
+            bool value;
+        #endif
+    };
+
+    constexpr std::size_t width = Float_pack::width;
+
+    #if defined(GF_SIMD_AVX2)
+
+    inline Float_pack splat(float x) { return {_mm256_set1_ps(x)}; }
+    inline Float_pack load(const float* data) { return {_mm256_loadu_ps(data)}; }
+    inline void store(float* data, Float_pack x) { _mm256_storeu_ps(data, x.value); }
+    inline Float_pack operator+(Float_pack a, Float_pack b) { return {_mm256_add_ps(a.value, b.value)}; }
+    inline Float_pack operator-(Float_pack a, Float_pack b) { return {_mm256_sub_ps(a.value, b.value)}; }
+    inline Float_pack operator*(Float_pack a, Float_pack b) { return {_mm256_mul_ps(a.value, b.value)}; }
+    inline Float_pack operator/(Float_pack a, Float_pack b) { return {_mm256_div_ps(a.value, b.value)}; }
+    inline Float_pack mul_add(Float_pack a, Float_pack b, Float_pack c) { return {_mm256_fmadd_ps(a.value, b.value, c.value)}; }
+    inline Float_pack min(Float_pack a, Float_pack b) { return {_mm256_min_ps(a.value, b.value)}; }
+    inline Float_pack max(Float_pack a, Float_pack b) { return {_mm256_max_ps(a.value, b.value)}; }
+    inline Float_pack sqrt(Float_pack x) { return {_mm256_sqrt_ps(x.value)}; }
+    inline Mask_pack operator<(Float_pack a, Float_pack b) { return {_mm256_cmp_ps(a.value, b.value, _CMP_LT_OQ)}; }
+    inline Mask_pack operator==(Float_pack a, Float_pack b) { return {_mm256_cmp_ps(a.value, b.value, _CMP_EQ_OQ)}; }
+    inline Float_pack select(Mask_pack mask, Float_pack a, Float_pack b) { return {_mm256_blendv_ps(b.value, a.value, mask.value)}; }
+
+    /**
+     * @brief Get x * 2^n for whole numbers n
+    */
+    inline Float_pack scale_by_power_of_two(Float_pack x, Float_pack n)
+    {
+        __m256i exponent = _mm256_slli_epi32(_mm256_cvtps_epi32(n.value), 23);
+        return {_mm256_castsi256_ps(_mm256_add_epi32(_mm256_castps_si256(x.value), exponent))};
+    }
+
+    inline Float_pack round(Float_pack x) { return {_mm256_round_ps(x.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)}; }
+
+    #elif defined(GF_SIMD_SSE2)
+
+    inline Float_pack splat(float x) { return {_mm_set1_ps(x)}; }
+    inline Float_pack load(const float* data) { return {_mm_loadu_ps(data)}; }
+    inline void store(float* data, Float_pack x) { _mm_storeu_ps(data, x.value); }
+    inline Float_pack operator+(Float_pack a, Float_pack b) { return {_mm_add_ps(a.value, b.value)}; }
+    inline Float_pack operator-(Float_pack a, Float_pack b) { return {_mm_sub_ps(a.value, b.value)}; }
+    inline Float_pack operator*(Float_pack a, Float_pack b) { return {_mm_mul_ps(a.value, b.value)}; }
+    inline Float_pack operator/(Float_pack a, Float_pack b) { return {_mm_div_ps(a.value, b.value)}; }
+    inline Float_pack mul_add(Float_pack a, Float_pack b, Float_pack c) { return {_mm_add_ps(_mm_mul_ps(a.value, b.value), c.value)}; }
+    inline Float_pack min(Float_pack a, Float_pack b) { return {_mm_min_ps(a.value, b.value)}; }
+    inline Float_pack max(Float_pack a, Float_pack b) { return {_mm_max_ps(a.value, b.value)}; }
+    inline Float_pack sqrt(Float_pack x) { return {_mm_sqrt_ps(x.value)}; }
+    inline Mask_pack operator<(Float_pack a, Float_pack b) { return {_mm_cmplt_ps(a.value, b.value)}; }
+    inline Mask_pack operator==(Float_pack a, Float_pack b) { return {_mm_cmpeq_ps(a.value, b.value)}; }
+    inline Float_pack select(Mask_pack mask, Float_pack a, Float_pack b) { return {_mm_or_ps(_mm_and_ps(mask.value, a.value), _mm_andnot_ps(mask.value, b.value))}; }
+
+    inline Float_pack scale_by_power_of_two(Float_pack x, Float_pack n)
+    {
+        __m128i exponent = _mm_slli_epi32(_mm_cvtps_epi32(n.value), 23);
+        return {_mm_castsi128_ps(_mm_add_epi32(_mm_castps_si128(x.value), exponent))};
+    }
+
+    inline Float_pack round(Float_pack x) { return {_mm_cvtepi32_ps(_mm_cvtps_epi32(x.value))}; } ///< Only for |x| < 2^31
+
+    #elif defined(GF_SIMD_NEON)
+
+    inline Float_pack splat(float x) { return {vdupq_n_f32(x)}; }
+    inline Float_pack load(const float* data) { return {vld1q_f32(data)}; }
+    inline void store(float* data, Float_pack x) { vst1q_f32(data, x.value); }
+    inline Float_pack operator+(Float_pack a, Float_pack b) { return {vaddq_f32(a.value, b.value)}; }
+    inline Float_pack operator-(Float_pack a, Float_pack b) { return {vsubq_f32(a.value, b.value)}; }
+    inline Float_pack operator*(Float_pack a, Float_pack b) { return {vmulq_f32(a.value, b.value)}; }
+    inline Float_pack operator/(Float_pack a, Float_pack b) { return {vdivq_f32(a.value, b.value)}; }
+    inline Float_pack mul_add(Float_pack a, Float_pack b, Float_pack c) { return {vfmaq_f32(c.value, a.value, b.value)}; }
+    inline Float_pack min(Float_pack a, Float_pack b) { return {vminq_f32(a.value, b.value)}; }
+    inline Float_pack max(Float_pack a, Float_pack b) { return {vmaxq_f32(a.value, b.value)}; }
+    inline Float_pack sqrt(Float_pack x) { return {vsqrtq_f32(x.value)}; }
+    inline Mask_pack operator<(Float_pack a, Float_pack b) { return {vcltq_f32(a.value, b.value)}; }
+    inline Mask_pack operator==(Float_pack a, Float_pack b) { return {vceqq_f32(a.value, b.value)}; }
+    inline Float_pack select(Mask_pack mask, Float_pack a, Float_pack b) { return {vbslq_f32(mask.value, a.value, b.value)}; }
+
+    inline Float_pack scale_by_power_of_two(Float_pack x, Float_pack n)
+    {
+        int32x4_t exponent = vshlq_n_s32(vcvtnq_s32_f32(n.value), 23);
+        return {vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(x.value), exponent))};
+    }
+
+    inline Float_pack round(Float_pack x) { return {vrndnq_f32(x.value)}; }
+
+    #else
+
+    inline Float_pack splat(float x) { return {x}; }
+    inline Float_pack load(const float* data) { return {*data}; }
+    inline void store(float* data, Float_pack x) { *data = x.value; }
+    inline Float_pack operator+(Float_pack a, Float_pack b) { return {a.value + b.value}; }
+    inline Float_pack operator-(Float_pack a, Float_pack b) { return {a.value - b.value}; }
+    inline Float_pack operator*(Float_pack a, Float_pack b) { return {a.value * b.value}; }
+    inline Float_pack operator/(Float_pack a, Float_pack b) { return {a.value / b.value}; }
+    inline Float_pack mul_add(Float_pack a, Float_pack b, Float_pack c) { return {a.value * b.value + c.value}; }
+    inline Float_pack min(Float_pack a, Float_pack b) { return {(b.value < a.value) ? b.value : a.value}; }
+    inline Float_pack max(Float_pack a, Float_pack b) { return {(a.value < b.value) ? b.value : a.value}; }
+    inline Float_pack sqrt(Float_pack x) { return {std::sqrt(x.value)}; }
+    inline Mask_pack operator<(Float_pack a, Float_pack b) { return {a.value < b.value}; }
+    inline Mask_pack operator==(Float_pack a, Float_pack b) { return {a.value == b.value}; }
+    inline Float_pack select(Mask_pack mask, Float_pack a, Float_pack b) { return {mask.value ? a.value : b.value}; }
+
+    inline Float_pack scale_by_power_of_two(Float_pack x, Float_pack n)
+    {
+        std::int32_t bits;
+        std::memcpy(&bits, &x.value, sizeof(bits));
+        bits += static_cast<std::int32_t>(n.value) * (1 << 23);
+        float result;
+        std::memcpy(&result, &bits, sizeof(result));
+        return {result};
+    }
+
+    inline Float_pack round(Float_pack x) { return {std::nearbyint(x.value)}; }
+
+    #endif
+
+    /**
+     * @brief Get sin(x) for x in [-pi/2, pi/2], accurate to about 1e-7
+    */
+    inline Float_pack sin_half_period(Float_pack x)
+    {
+        // Taylor series to x^11, whose error at pi/2 is below float precision
+        Float_pack x2 = x * x;
+        Float_pack p = splat(-2.5052108e-8f);
+        p = mul_add(p, x2, splat(2.7557319e-6f));
+        p = mul_add(p, x2, splat(-1.9841270e-4f));
+        p = mul_add(p, x2, splat(8.3333333e-3f));
+        p = mul_add(p, x2, splat(-1.6666667e-1f));
+        p = mul_add(p, x2, splat(1.0f));
+        return x * p;
+    }
+
+    /**
+     * @brief Get 2^x, accurate to a few ulp for x in [-125, 127]
+    */
+    inline Float_pack exp2(Float_pack x)
+    {
+        x = min(max(x, splat(-125.0f)), splat(127.0f));
+        Float_pack whole = round(x);
+        Float_pack f = x - whole;
+
+        // 2^f on [-0.5, 0.5], coefficients from Cephes exp2f
+        Float_pack p = splat(1.535336188319500e-4f);
+        p = mul_add(p, f, splat(1.339887440266574e-3f));
+        p = mul_add(p, f, splat(9.618437357674640e-3f));
+        p = mul_add(p, f, splat(5.550332471162809e-2f));
+        p = mul_add(p, f, splat(2.402264791363012e-1f));
+        p = mul_add(p, f, splat(6.931472028550421e-1f));
+        p = mul_add(p, f, splat(1.0f));
+        return scale_by_power_of_two(p, whole);
+    }
+
+    /**
+     * @brief Apply a kernel to every element of an array, a pack at a time
+     *
+     * The tail is padded into a full pack so that every element goes through the same code.
+     *
+     * @param kernel Maps a Float_pack to a Float_pack
+     * @param input The input array
+     * @param output The output array, may alias the input
+     * @param count The number of elements
+     * @param padding The value the tail is padded with, which must be a valid input
+    */
+    template <typename Kernel>
+    void transform(Kernel kernel, const float* input, float* output, std::size_t count, float padding = 0.0f)
+    {
+        std::size_t i = 0;
+        for (; i + width <= count; i += width)
+        {
+            store(output + i, kernel(load(input + i)));
+        }
+
+        if (i < count)
+        {
+            float tail[width];
+            for (std::size_t j = 0; j < width; ++j)
+                tail[j] = (i + j < count) ? input[i + j] : padding;
+
+            store(tail, kernel(load(tail)));
+            for (std::size_t j = 0; i + j < count; ++j)
+                output[i + j] = tail[j];
+        }
+    }
+
+} // namespace gf::simd
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Vector2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief The kinds of cubic curve a Spline_path can be built from
+    */
+    enum class Spline_type : std::uint8_t
+    {
+        catmull_rom, ///< Passes through every control point, needs at least 2
+        cubic_bezier, ///< Passes through every third control point, the others pull the curve, needs 3n + 1
+        b_spline ///< Uniform cubic B-spline, smooth but passes through no control point, needs at least 4
+    };
+
+    /**
+     * @brief A path through the plane made of cubic segments, with a table for moving along it at constant speed
+     *
+     * Every segment is stored as the coefficients of its cubic polynomial whatever the spline type,
+     * so evaluating a point costs the same for all of them. The path is parameterized by u, which
+     * goes from 0 to 1 across each segment in turn and is not proportional to distance.
+     *
+     * At construction the path is sampled densely to measure its length, and the result is
+     * resampled into a table of u at evenly spaced distances. Looking up the point at a distance
+     * is then one table read, one interpolation and one curve evaluation, with no searching or
+     * integration per frame.
+    */
+    class Spline_path
+    {
+        public:
+            /**
+             * @brief Build a path from control points
+             *
+             * @param type The kind of curve
+             * @param control_points The control points
+             * @param samples_per_segment The resolution of the arc length table
+             * @throws std::invalid_argument If there are not the right number of control points for the type
+            */
+            Spline_path(Spline_type type, const std::vector<Vector2f>& control_points, std::size_t samples_per_segment = 16);
+
+            /**
+             * @brief Get the number of cubic segments
+            */
+            std::size_t get_segment_count() const;
+
+            /**
+             * @brief Get the total length of the path
+            */
+            float get_length() const;
+
+            /**
+             * @brief Get the point at a parameter
+             *
+             * @param u The parameter, from 0 at the start to the segment count at the end, clamped
+            */
+            Vector2f get_point(float u) const;
+
+            /**
+             * @brief Get the derivative of the path at a parameter, which points along the path
+            */
+            Vector2f get_tangent(float u) const;
+
+            /**
+             * @brief Get the parameter at a distance along the path, clamped to the ends
+            */
+            float get_parameter_at_distance(float distance) const;
+
+            /**
+             * @brief Get the point at a distance along the path, clamped to the ends
+            */
+            Vector2f get_point_at_distance(float distance) const;
+
+            /**
+             * @brief Get the unit direction of the path at a distance along it
+            */
+            Vector2f get_direction_at_distance(float distance) const;
+
+            /**
+             * @brief Get the points at many distances along the path
+             *
+             * @param distances The distances
+             * @param points The points, one per distance
+             * @param directions The unit directions, one per distance, or nullptr if they are not wanted
+             * @param count The number of distances
+            */
+            void get_points_at_distances(const float* distances, Vector2f* points, Vector2f* directions, std::size_t count) const;
+
+        private:
+            /**
+             * @brief The cubic a + b s + c s^2 + d s^3 of one segment, with s in [0, 1]
+            */
+            struct Segment
+            {
+                Vector2f a;
+                Vector2f b;
+                Vector2f c;
+                Vector2f d;
+            };
+
+            /**
+             * @brief Split a parameter into a segment and the parameter within it
+            */
+            const Segment& locate(float u, float& s) const;
+
+            void build_arc_length_table(std::size_t samples_per_segment);
+
+            std::vector<Segment> segments;
+            std::vector<float> parameters_by_distance; ///< u at evenly spaced distances from 0 to length
+            float length = 0.0f;
+            float table_scale = 0.0f; ///< The number of table intervals per unit of distance
+    };
+
+} // namespace gf
@@ -2,7 +2,7 @@
 
 #include <unordered_map>
 #include <vector>
-#include <functional>
+#include "Inplace_function.hpp"
 
 namespace gf
 {
@@ -29,7 +29,7 @@ namespace gf
             void update();
             void set_state(int state_id);
             int get_current_state_id();
-            void add_trigger(int state_id, std::function<bool()> trigger);
+            void add_trigger(int state_id, Inplace_function<bool()> trigger);
             bool is_blocked(int trigger_id);
 
             State_machine():
@@ -44,7 +44,7 @@ namespace gf
 
         private:
             State* current_state;
-            std::vector<std::pair<int, std::function<bool()>> > triggers;
+            std::vector<std::pair<int, Inplace_function<bool()>> > triggers;
             std::unordered_map<int, State*> states;
     };
 
@@ -33,6 +33,13 @@ namespace gf
                 milliseconds(other.milliseconds)
             {}
 
+            /**
+             * @brief Copy assignment operator
+             * 
+             * @param other The Time object to copy
+            */
+            constexpr Time& operator=(const Time& other) = default;
+
             /**
              * @brief Construct a new Time object
              * 
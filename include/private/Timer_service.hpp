@@ -0,0 +1,195 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Handle.hpp"
+#include "Inplace_function.hpp"
+#include "Time.hpp"
+
+namespace gf
+{
+    class Timer;
+
+    /**
+     * @brief Runs many timers on a hierarchical timing wheel
+     *
+     * Time advances in whole ticks of a fixed resolution, 1 ms by default. A timer due within 256
+     * ticks sits in a slot of the first wheel, one due later sits in a coarser wheel and is moved
+     * down when its slot comes around, and so on over four wheels of 256 slots, about 49 days at
+     * 1 ms. Timers due later still wait in the last wheel until they are in range.
+     *
+     * Scheduling and cancelling a timer link or unlink it from a slot list. Ticking skips straight
+     * to the next occupied slot of the first wheel, so the cost of a tick is proportional to the
+     * timers that fire plus the occasional move down from a coarser wheel, not to the timers waiting.
+     *
+     * Callbacks run inside tick, in order of their due tick, and may schedule or cancel timers.
+    */
+    class Timer_service
+    {
+        public:
+            struct Timer_record;
+            using Timer_handle = Handle<Timer_record>;
+
+            static constexpr std::size_t level_count = 4;
+            static constexpr std::size_t slot_bits = 8;
+            static constexpr std::size_t slot_count = 1 << slot_bits;
+
+            /**
+             * @brief Construct a timer service starting at time zero
+             *
+             * @param resolution The length of one tick, delays are rounded up to a whole number of ticks
+             * @throws std::invalid_argument If the resolution is not positive
+            */
+            explicit Timer_service(const Time& resolution = Time(1.0f));
+
+            Timer_service(const Timer_service&) = delete;
+            Timer_service& operator=(const Timer_service&) = delete;
+
+            /**
+             * @brief Call a function once after a delay, the timer is removed when it fires
+            */
+            Timer_handle schedule(const Time& delay, const Inplace_function<void()>& callback);
+
+            /**
+             * @brief Call a function every period until the timer is cancelled
+             *
+             * The period is at least one tick.
+            */
+            Timer_handle schedule_repeating(const Time& period, const Inplace_function<void()>& callback);
+
+            /**
+             * @brief Remove a timer without calling it, does nothing if the handle is stale
+            */
+            void cancel(Timer_handle timer);
+
+            /**
+             * @brief Check whether a timer is still scheduled or held by a Timer
+            */
+            bool contains(Timer_handle timer) const;
+
+            /**
+             * @brief Get the time until a timer fires next, zero once a Timer has finished
+             *
+             * @throws std::out_of_range If the handle is stale
+            */
+            Time get_remaining_time(Timer_handle timer) const;
+
+            /**
+             * @brief Advance time, calling every timer that comes due
+            */
+            void tick(const Time& delta_time);
+
+            /**
+             * @brief Get the time elapsed since the service was constructed, in whole ticks
+            */
+            Time get_time() const;
+
+            Time get_resolution() const;
+
+            /**
+             * @brief Get the number of timers, including finished ones held by a Timer
+            */
+            std::size_t size() const;
+
+            struct Timer_record
+            {
+                Inplace_function<void()> callback;
+                Time length; ///< The length asked for, before rounding to ticks
+                std::uint64_t start; ///< The tick the timer was started at
+                std::uint64_t deadline; ///< The tick the timer is due at
+                std::uint64_t period; ///< The ticks between repeats, zero for a one shot timer
+                Timer_handle previous; ///< The previous timer in the same slot
+                Timer_handle next; ///< The next timer in the same slot
+                std::uint16_t slot; ///< The wheel slot, level * slot_count + index, or no_slot
+                bool owned; ///< Held by a Timer, which keeps it after it fires
+            };
+
+        private:
+            friend class Timer;
+
+            static constexpr std::uint16_t no_slot = 0xFFFF;
+
+            Timer_handle create(const Time& length, std::uint64_t period, bool owned, const Inplace_function<void()>& callback);
+
+            /**
+             * @brief Move a timer to the slot of its deadline, or of the next tick if that has passed
+            */
+            void start(Timer_handle timer, Timer_record& record);
+
+            std::uint64_t to_ticks(const Time& time) const;
+
+            /**
+             * @brief Put a timer in the wheel slot of a tick, which must not be before the current one
+            */
+            void link(Timer_handle timer, Timer_record& record, std::uint64_t due);
+
+            void unlink(Timer_record& record);
+
+            void cascade(std::size_t level);
+
+            void fire_slot(std::size_t index);
+
+            void advance_to(std::uint64_t target);
+
+            Slot_table<Timer_record, Timer_record> timers;
+            std::array<Timer_handle, level_count * slot_count> slots;
+            std::array<std::uint64_t, slot_count / 64> occupied; ///< One bit per slot of the first wheel
+            std::vector<Timer_handle> firing;
+            std::size_t timer_count = 0;
+            std::uint64_t current = 0; ///< The current tick
+            float resolution;
+            float accumulated = 0.0f; ///< Milliseconds not yet making up a whole tick
+    };
+
+    /**
+     * @brief A Clock whose timing is done by a Timer_service
+     *
+     * It has the interface of a Clock except for tick: the service advances every Timer at once,
+     * and only the timers that finish cost anything. Unlike a Clock, the callback is called once
+     * when the timer finishes rather than on every tick after. Times are rounded to the service's
+     * resolution.
+     *
+     * The service must outlive its timers.
+    */
+    class Timer
+    {
+        public:
+            Timer(Timer_service& service, const Time& length);
+            Timer(Timer_service& service, const Time& length, const Inplace_function<void()>& new_callback);
+
+            /**
+             * @brief Construct a timer that has already run for some time, like the Clock constructor with an elapsed time
+            */
+            Timer(Timer_service& service, const Time& length, const Time& elapsed, const Inplace_function<void()>& new_callback);
+
+            Timer(Timer&& other) noexcept;
+            Timer& operator=(Timer&& other) noexcept;
+            Timer(const Timer&) = delete;
+            Timer& operator=(const Timer&) = delete;
+            ~Timer();
+
+            void restart();
+            void reset(const Time& length);
+
+            /**
+             * @brief Change the length, keeping the elapsed time, which can finish or unfinish the timer
+            */
+            void set_length(const Time& new_length);
+
+            Time get_length() const;
+            float get_normalized_progress() const;
+            Time get_elapsed_time() const;
+            Time get_remaining_time() const;
+            bool get_finished() const;
+
+            void add_callback(const Inplace_function<void()>& new_callback);
+
+        private:
+            Timer_service::Timer_record& get_record() const;
+
+            Timer_service* service;
+            Timer_service::Timer_handle handle;
+    };
+
+} // namespace gf
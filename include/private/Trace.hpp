@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#define GF_PROFILE_CONCAT_IMPL(a, b) a##b
+#define GF_PROFILE_CONCAT(a, b) GF_PROFILE_CONCAT_IMPL(a, b)
+
+namespace gf::profiling
+{
+    namespace detail
+    {
+        extern std::atomic<bool> tracing;
+    }
+
+    /**
+     * @brief Start streaming trace events to a file in the Chrome trace event format
+     *
+     * The file can be opened in chrome://tracing or the Perfetto UI. Each thread collects events in
+     * its own buffer and appends them to the file when the buffer is full, so memory stays bounded
+     * however long the trace runs.
+     *
+     * @param path The file to write, replaced if it exists
+     * @param events_per_thread The number of events a thread buffers before writing them out
+     * @throws std::runtime_error If a trace is already running or the file cannot be opened
+    */
+    void start_trace(const std::string& path, std::size_t events_per_thread = 4096);
+
+    /**
+     * @brief Write out every buffered event and close the trace file
+    */
+    void stop_trace();
+
+    inline bool is_tracing()
+    {
+        return detail::tracing.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add an event covering a span of time on the calling thread
+     *
+     * Spans on the same thread nest by time, which is how the viewer builds the call tree.
+    */
+    void trace_complete(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+
+    /**
+     * @brief Add an event marking a moment on the calling thread
+     *
+     * @param name The name of the event, which must outlive the trace
+     * @param arg_name The name of an optional integer argument shown with the event
+     * @param arg_value The value of the argument
+    */
+    void trace_instant(const char* name, const char* arg_name = nullptr, std::int64_t arg_value = 0);
+
+    /**
+     * @brief Add an event marking a moment across every thread, like the end of a frame
+    */
+    void trace_global_instant(const char* name);
+
+    /**
+     * @brief Traces the time between its construction and destruction without adding it to the profile
+     *
+     * Used for recursive scopes, whose inclusive times would be counted once per level in the profile.
+    */
+    class Trace_scope
+    {
+        public:
+            explicit Trace_scope(const char* name):
+                name{is_tracing() ? name : nullptr}
+            {
+                if (this->name)
+                    start = std::chrono::steady_clock::now();
+            }
+
+            Trace_scope(const Trace_scope&) = delete;
+            Trace_scope& operator=(const Trace_scope&) = delete;
+
+            ~Trace_scope()
+            {
+                if (name && is_tracing())
+                    trace_complete(name, start, std::chrono::steady_clock::now());
+            }
+
+        private:
+            const char* name;
+            std::chrono::steady_clock::time_point start;
+    };
+
+} // namespace gf::profiling
+
+/**
+ * @brief Trace the rest of the enclosing scope under a name, or mark a moment
+ *
+ * Compile to nothing unless the library is built with USE_PROFILING.
+*/
+#ifdef GF_USING_PROFILING
+    #define GF_TRACE_SCOPE(name) ::gf::profiling::Trace_scope GF_PROFILE_CONCAT(gf_trace_scope_, __LINE__){name}
+    #define GF_TRACE_INSTANT(...) do { if (::gf::profiling::is_tracing()) ::gf::profiling::trace_instant(__VA_ARGS__); } while (false)
+#else
+    #define GF_TRACE_SCOPE(name) ((void)0)
+    #define GF_TRACE_INSTANT(...) ((void)0)
+#endif
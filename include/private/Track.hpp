@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "Angle.hpp"
+#include "Interpolation.hpp"
+#include "Time.hpp"
+#include "Transform2.hpp"
+#include "Vector2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief What a track does with times past its last key
+    */
+    enum class Track_wrap : std::uint8_t
+    {
+        clamp, ///< Hold the first and last values
+        loop, ///< Start again from the first key
+        ping_pong ///< Play backwards to the first key, then forwards again
+    };
+
+    /**
+     * @brief Remembers where the last sample of a track was, so that the next sample at a later time starts looking from there
+     *
+     * A cursor can be used with any track, a stale one only costs a binary search.
+    */
+    struct Track_cursor
+    {
+        std::uint32_t segment = 0; ///< The index of the key that starts the last sampled segment
+    };
+
+    /**
+     * @brief Interpolates the values of a track, as a + (b - a) * t unless specialized
+    */
+    template <typename T>
+    struct Track_interpolation
+    {
+        static T interpolate(const T& a, const T& b, float t)
+        {
+            return a + (b - a) * t;
+        }
+    };
+
+    /**
+     * @brief Transforms interpolate every component as given, so that keys can describe a rotation of more than half a turn
+    */
+    template <>
+    struct Track_interpolation<Transform2>
+    {
+        static Transform2 interpolate(const Transform2& a, const Transform2& b, float t)
+        {
+            return Transform2(
+                a.position + (b.position - a.position) * t,
+                a.rotation + (b.rotation - a.rotation) * t,
+                a.scale + (b.scale - a.scale) * t
+            );
+        }
+    };
+
+    /**
+     * @brief A sequence of keyframes, interpolated with a separate easing per segment
+     *
+     * Key times, values and easings are stored in separate contiguous arrays and sampling never
+     * allocates. Sampling with a cursor is amortized constant time while time moves forwards, and
+     * falls back to a binary search on seeks.
+     *
+     * Values are interpolated as given, angles included, so keys 0 and 2 pi make a whole turn.
+     *
+     * @tparam T The type of the values, float, Vector2f, Angle and Transform2 are supported
+    */
+    template <typename T>
+    class Track
+    {
+        public:
+            /**
+             * @brief Construct an empty track
+             *
+             * @param wrap What to do with times past the last key
+            */
+            explicit Track(Track_wrap wrap = Track_wrap::clamp):
+                wrap{wrap}
+            {}
+
+            /**
+             * @brief Add a key, keeping the keys sorted by time
+             *
+             * @param time The time of the key
+             * @param value The value at that time
+             * @param easing The easing of the segment from this key to the next
+            */
+            void add_key(const Time& time, const T& value, Easing_type easing = Easing_type::linear)
+            {
+                float milliseconds = time.get_milliseconds();
+                auto index = std::upper_bound(times.begin(), times.end(), milliseconds) - times.begin();
+                times.insert(times.begin() + index, milliseconds);
+                values.insert(values.begin() + index, value);
+                easings.insert(easings.begin() + index, easing);
+            }
+
+            /**
+             * @brief Reserve room for keys, so that adding them does not reallocate
+            */
+            void reserve(std::size_t key_count)
+            {
+                times.reserve(key_count);
+                values.reserve(key_count);
+                easings.reserve(key_count);
+            }
+
+            void clear()
+            {
+                times.clear();
+                values.clear();
+                easings.clear();
+            }
+
+            std::size_t get_key_count() const
+            {
+                return times.size();
+            }
+
+            Time get_key_time(std::size_t index) const
+            {
+                return Time(times.at(index));
+            }
+
+            const T& get_key_value(std::size_t index) const
+            {
+                return values.at(index);
+            }
+
+            /**
+             * @brief Get the time of the last key, or zero for an empty track
+            */
+            Time get_length() const
+            {
+                return times.empty() ? Time() : Time(times.back());
+            }
+
+            Track_wrap get_wrap() const
+            {
+                return wrap;
+            }
+
+            void set_wrap(Track_wrap new_wrap)
+            {
+                wrap = new_wrap;
+            }
+
+            /**
+             * @brief Sample the track, finding the segment with a binary search
+             *
+             * @throws std::out_of_range If the track has no keys
+            */
+            T sample(const Time& time) const
+            {
+                Track_cursor cursor;
+                return sample(time, cursor);
+            }
+
+            /**
+             * @brief Sample the track, starting the search for the segment from a cursor and updating it
+             *
+             * @throws std::out_of_range If the track has no keys
+            */
+            T sample(const Time& time, Track_cursor& cursor) const
+            {
+                if (times.empty())
+                {
+                    throw std::out_of_range("Cannot sample a track without keys");
+                }
+
+                float t = get_local_time(time.get_milliseconds());
+                if (times.size() == 1 || t <= times.front())
+                    return values.front();
+                if (t >= times.back())
+                    return values.back();
+
+                std::size_t segment = find_segment(t, cursor);
+                float progress = (t - times[segment]) / (times[segment + 1] - times[segment]);
+                return Track_interpolation<T>::interpolate(values[segment], values[segment + 1], easing::evaluate(easings[segment], progress));
+            }
+
+        private:
+            /**
+             * @brief Map a time onto the keys according to the wrap mode
+            */
+            float get_local_time(float t) const
+            {
+                float start = times.front();
+                float length = times.back() - start;
+                if (wrap == Track_wrap::clamp || length <= 0.0f || (t >= start && t <= times.back()))
+                    return t;
+
+                float period = (wrap == Track_wrap::loop) ? length : 2.0f * length;
+                float offset = std::fmod(t - start, period);
+                if (offset < 0.0f)
+                    offset += period;
+                if (offset > length)
+                    offset = period - offset;
+                return start + offset;
+            }
+
+            /**
+             * @brief Find the segment containing t, which lies strictly between the first and last keys
+            */
+            std::size_t find_segment(float t, Track_cursor& cursor) const
+            {
+                constexpr std::size_t max_steps = 4;
+
+                std::size_t segment = cursor.segment;
+                if (segment + 1 < times.size() && times[segment] <= t)
+                {
+                    // Advancing a frame rarely crosses more than a key or two
+                    for (std::size_t step = 0; step < max_steps; ++step)
+                    {
+                        if (t < times[segment + 1])
+                        {
+                            cursor.segment = static_cast<std::uint32_t>(segment);
+                            return segment;
+                        }
+                        ++segment;
+                    }
+                }
+
+                segment = static_cast<std::size_t>(std::upper_bound(times.begin(), times.end(), t) - times.begin()) - 1;
+                cursor.segment = static_cast<std::uint32_t>(segment);
+                return segment;
+            }
+
+            std::vector<float> times; ///< The key times in milliseconds, sorted
+            std::vector<T> values; ///< The key values
+            std::vector<Easing_type> easings; ///< The easing of the segment starting at each key
+            Track_wrap wrap;
+    };
+
+    /**
+     * @brief Plays a track like a Linear_process, keeping its own time and cursor
+     *
+     * The track must outlive the player. Players are small, so thousands can share a track.
+    */
+    template <typename T>
+    class Track_player
+    {
+        public:
+            explicit Track_player(const Track<T>& track):
+                track{&track}
+            {}
+
+            void update(const Time& dt)
+            {
+                elapsed += dt;
+            }
+
+            /**
+             * @brief Restart from the beginning of the track
+            */
+            void reset()
+            {
+                elapsed = Time();
+                cursor = Track_cursor();
+            }
+
+            /**
+             * @brief Jump to a time, the next sample searches for its segment
+            */
+            void seek(const Time& time)
+            {
+                elapsed = time;
+            }
+
+            Time get_elapsed_time() const
+            {
+                return elapsed;
+            }
+
+            /**
+             * @brief Get whether a clamped track has played to its end, looping tracks never finish
+            */
+            bool get_finished() const
+            {
+                return track->get_wrap() == Track_wrap::clamp && elapsed >= track->get_length();
+            }
+
+            /**
+             * @brief Get the value of the track at the current time
+            */
+            T get() const
+            {
+                return track->sample(elapsed, cursor);
+            }
+
+        private:
+            const Track<T>* track;
+            Time elapsed;
+            mutable Track_cursor cursor; ///< Only a lookup cache
+    };
+
+} // namespace gf
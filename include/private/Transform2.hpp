@@ -1,10 +1,22 @@
 #pragma once
+#include <cstddef>
 #include <iostream>
 #include "Angle.hpp"
+#include "Matrix2x3.hpp"
 #include "Vector2.hpp"
 
 namespace gf
 {
+    /**
+     * @brief A position, rotation and scale in 2D
+     *
+     * The transform keeps the sine and cosine of its rotation, refreshed by every method that
+     * changes the rotation, so transforming points and composing transforms does no trigonometry.
+     * Writing the rotation member directly is still allowed, but the basis is then recomputed on
+     * each use until a method next sets the rotation, so prefer set_rotation. The basis is always
+     * computed with Angle::sincos(Trig_precision::high) after taking whole turns off the rotation,
+     * which keeps the constructors constexpr and rotations accumulated over a long session accurate.
+    */
     struct Transform2
     {
         /* Constructors */
@@ -16,7 +28,9 @@ namespace gf
         constexpr Transform2():
             position{},
             rotation{},
-            scale{1.0f, 1.0f}
+            scale{1.0f, 1.0f},
+            basis{0.0f, 1.0f},
+            basis_rotation{0.0f}
         {}
 
         /**
@@ -30,7 +44,9 @@ namespace gf
         constexpr Transform2(const float x, const float y, const Angle& rotation):
             position{x, y},
             rotation{rotation},
-            scale{1.0f, 1.0f}
+            scale{1.0f, 1.0f},
+            basis{compute_basis(rotation)},
+            basis_rotation{rotation.get_radians()}
         {}
 
         /**
@@ -42,7 +58,9 @@ namespace gf
         constexpr Transform2(const Vector2f& position, const Angle& rotation):
             position{position},
             rotation{rotation},
-            scale{1.0f, 1.0f}
+            scale{1.0f, 1.0f},
+            basis{compute_basis(rotation)},
+            basis_rotation{rotation.get_radians()}
         {}
 
         /**
@@ -55,7 +73,9 @@ namespace gf
         constexpr Transform2(const Vector2f& position, const Angle& rotation, const Vector2f& scale):
             position{position},
             rotation{rotation},
-            scale{scale}
+            scale{scale},
+            basis{compute_basis(rotation)},
+            basis_rotation{rotation.get_radians()}
         {}
 
         /**
@@ -70,7 +90,9 @@ namespace gf
         constexpr Transform2(const float x, const float y, const Angle& rotation, const float scale_x, const float scale_y):
             position{x, y},
             rotation{rotation},
-            scale{scale_x, scale_y}
+            scale{scale_x, scale_y},
+            basis{compute_basis(rotation)},
+            basis_rotation{rotation.get_radians()}
         {}
 
         /* Getters */
@@ -103,6 +125,19 @@ namespace gf
         */
         std::string get_string() const;
 
+        /**
+         * @brief Get the sine and cosine of the rotation
+        */
+        constexpr Sin_cos get_basis() const
+        {
+            return (basis_rotation == rotation.get_radians()) ? basis : compute_basis(rotation);
+        }
+
+        /**
+         * @brief Get the transform as a matrix, scaling then rotating then translating
+        */
+        Matrix2x3 get_matrix() const;
+
         /* Setters */
 
         /**
@@ -129,12 +164,17 @@ namespace gf
         /* Operators */
 
         /**
-         * @brief Multiply two transforms.
+         * @brief Compose two transforms, the result applies other first and then this.
+         *
+         * The position of other is transformed by this, rotations add and scales multiply, which is
+         * what attaching other as a child of this means. It is exact unless this has a non uniform
+         * scale and other is rotated, where the result would need a shear, compose the matrices
+         * from get_matrix for that.
         */
         Transform2 operator*(const Transform2& other) const;
 
         /**
-         * @brief Multiply a transform by another transform.
+         * @brief Compose a transform with another transform, applying other first.
         */
         Transform2& operator*=(const Transform2& other);
 
@@ -190,6 +230,30 @@ namespace gf
 
         /* Methods */
 
+        /**
+         * @brief Transform a point from the local space of the transform to its parent's space.
+        */
+        Vector2f transform_point(const Vector2f& point) const;
+
+        /**
+         * @brief Transform an offset, scaling and rotating it without translating.
+        */
+        Vector2f transform_vector(const Vector2f& vector) const;
+
+        /**
+         * @brief Transform an array of points, building the matrix once.
+         *
+         * @param points The points to transform.
+         * @param result Where to write the transformed points, may be points.
+         * @param count The number of points.
+        */
+        void transform_points(const Vector2f* points, Vector2f* result, std::size_t count) const;
+
+        /**
+         * @brief Transform points stored as separate x and y arrays, building the matrix once.
+        */
+        void transform_points(const float* x, const float* y, float* result_x, float* result_y, std::size_t count) const;
+
         /**
          * @brief Translate the transform by a vector.
          *
@@ -244,6 +308,17 @@ namespace gf
         */
         Transform2 get_scaled(const Vector2f& factors) const;
 
+        /**
+         * @brief Get the transform between this transform and another.
+         *
+         * Position and scale are interpolated linearly, and rotation along the shortest path.
+         *
+         * @param target The transform to interpolate towards.
+         * @param t The interpolation factor, 0 gives this transform and 1 gives the target.
+         * @return The interpolated transform.
+        */
+        Transform2 get_interpolated(const Transform2& target, float t) const;
+
         /* Print utilities */
 
         /**
@@ -260,5 +335,31 @@ namespace gf
         Vector2f position; ///< The position of the transform.
         Angle rotation; ///< The rotation of the transform.
         Vector2f scale; ///< The scale of the transform.
+
+    private:
+        Transform2(const Vector2f& position, const Angle& rotation, const Vector2f& scale, const Sin_cos& basis):
+            position{position},
+            rotation{rotation},
+            scale{scale},
+            basis{basis},
+            basis_rotation{rotation.get_radians()}
+        {}
+
+        /**
+         * @brief Compute the sine and cosine of a rotation, reduced first so that long accumulated rotations stay accurate
+        */
+        static constexpr Sin_cos compute_basis(const Angle& rotation)
+        {
+            return rotation.get_reduced().sincos(Trig_precision::high);
+        }
+
+        void refresh_basis()
+        {
+            basis = compute_basis(rotation);
+            basis_rotation = rotation.get_radians();
+        }
+
+        Sin_cos basis; ///< The sine and cosine of basis_rotation
+        float basis_rotation; ///< The rotation in radians the basis was computed for
     };
 } // namespace gf
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "Angle.hpp"
+#include "Handle.hpp"
+#include "Interpolation.hpp"
+#include "Time.hpp"
+#include "Transform2.hpp"
+#include "Vector2.hpp"
+
+namespace gf
+{
+    /**
+     * @brief Runs many tweens with one batched update
+     *
+     * Each tween behaves like a Linear_process with the same start, end, length and easing: it
+     * reaches its end value once its length has elapsed, angles take the shortest path like an
+     * Angular_linear_process, and transforms interpolate position, rotation and scale. Instead of
+     * a Clock per tween, tweens are split into floats and stored in struct of arrays form, one
+     * bucket per easing type, so that update advances every float in a bucket with a few tight
+     * loops the compiler can vectorize.
+     *
+     * If a tween has a target, its current value is written to it after every update. A tween is
+     * removed by the update that finishes it, after writing its end value, and its handle goes stale.
+     * Targets must outlive their tweens.
+    */
+    class Tween_manager
+    {
+        public:
+            struct Tween;
+            using Tween_handle = Handle<Tween>;
+
+            /**
+             * @brief Add a tween of a float
+            */
+            Tween_handle add(float start, float end, const Time& length, Easing_type easing = Easing_type::linear, float* target = nullptr);
+
+            /**
+             * @brief Add a tween of a vector
+            */
+            Tween_handle add(const Vector2f& start, const Vector2f& end, const Time& length, Easing_type easing = Easing_type::linear, Vector2f* target = nullptr);
+
+            /**
+             * @brief Add a tween of an angle, which takes the shortest path between its start and end
+            */
+            Tween_handle add(const Angle& start, const Angle& end, const Time& length, Easing_type easing = Easing_type::linear, Angle* target = nullptr);
+
+            /**
+             * @brief Add a tween of a transform
+            */
+            Tween_handle add(const Transform2& start, const Transform2& end, const Time& length, Easing_type easing = Easing_type::linear, Transform2* target = nullptr);
+
+            /**
+             * @brief Advance every tween, write their targets and remove the finished ones
+            */
+            void update(const Time& dt);
+
+            /**
+             * @brief Jump a tween to its end value, it is removed by the next update
+            */
+            void finish(Tween_handle tween);
+
+            /**
+             * @brief Remove a tween without writing its target again, its floats are compacted out by the next update
+            */
+            void remove(Tween_handle tween);
+
+            /**
+             * @brief Check whether a tween is still running
+            */
+            bool contains(Tween_handle tween) const;
+
+            /**
+             * @brief Get the current value of a float tween
+             *
+             * @throws std::out_of_range If the handle is stale
+             * @throws std::invalid_argument If the tween is of another type
+            */
+            float get_float(Tween_handle tween) const;
+
+            Vector2f get_vector(Tween_handle tween) const;
+
+            Angle get_angle(Tween_handle tween) const;
+
+            Transform2 get_transform(Tween_handle tween) const;
+
+            /**
+             * @brief Get how far a tween is through its length, in [0, 1]
+            */
+            float get_progress(Tween_handle tween) const;
+
+            /**
+             * @brief Get the number of running tweens
+            */
+            std::size_t size() const;
+
+            /**
+             * @brief Remove every tween
+            */
+            void clear();
+
+        private:
+            enum class Kind : std::uint8_t
+            {
+                scalar,
+                vector,
+                angle,
+                transform
+            };
+
+            /**
+             * @brief The floats of every tween with the same easing, a tween's floats are adjacent
+            */
+            struct Bucket
+            {
+                std::vector<float> elapsed;
+                std::vector<float> length;
+                std::vector<float> start;
+                std::vector<float> end;
+                std::vector<float> value;
+                std::vector<Tween_handle> owners; ///< The tween of each float
+            };
+
+            struct Record
+            {
+                Kind kind;
+                Easing_type easing;
+                std::uint8_t count; ///< The number of floats
+                std::uint32_t first; ///< The index of the first float in the bucket
+                void* target;
+                bool removed; ///< Removed but not yet compacted out
+            };
+
+            Tween_handle add(Kind kind, const float* start, const float* end, std::uint8_t count, const Time& length, Easing_type easing, void* target);
+
+            Record* find_running(Tween_handle tween);
+
+            const Record* find_running(Tween_handle tween) const;
+
+            const Record& get_record(Tween_handle tween, Kind kind) const;
+
+            static void write_target(const Record& record, const float* value);
+
+            std::array<Bucket, easing_type_count> buckets;
+            Slot_table<Tween, Record> records;
+            std::size_t tween_count = 0;
+            std::vector<float> scratch;
+    };
+
+} // namespace gf
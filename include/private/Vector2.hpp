@@ -34,7 +34,16 @@ namespace gf
          * 
          * @param angle The angle of the vector
         */
-        constexpr static inline Vector2 from_angle(const Angle& angle);
+        static inline Vector2 from_angle(const Angle& angle);
+
+        /**
+         * @brief Construct a unit vector in the direction of an angle with a chosen precision,
+         * which can be evaluated at compile time for the polynomial tiers
+         *
+         * @param angle The angle of the vector
+         * @param precision The precision of the sine and cosine
+        */
+        constexpr static inline Vector2 from_angle(const Angle& angle, Trig_precision precision);
 
         /**
          * @brief Constructor for the vector that takes an x 
@@ -151,8 +160,9 @@ namespace gf
         {
            	if (angle != 0)
             {
-                float sin_of = angle.sin();
-                float cos_of = angle.cos();
+                Sin_cos sin_cos = angle.sincos();
+                float sin_of = sin_cos.sin;
+                float cos_of = sin_cos.cos;
 
                 x = (x * cos_of) - (y * sin_of);
                 y = (x * sin_of) + (y * cos_of);
@@ -191,7 +201,7 @@ namespace gf
         Vector2 get_normalized() const
         {
             Vector_type length = get_length();
-            if (length != 0)
+            if (length != Vector_type{})
                 return Vector2(x / length, y / length);
             else
                 return Vector2(0, 0);
@@ -202,7 +212,9 @@ namespace gf
         */
         Vector_type get_length() const
         {
-            return std::sqrt((x * x) + (y * y));
+            // Unqualified so that component types such as Fixed are found by argument dependent lookup
+            using std::sqrt;
+            return sqrt((x * x) + (y * y));
         }
 
         /**
@@ -210,9 +222,8 @@ namespace gf
         */
         Vector2 get_rotated(const Angle& angle) const
         {
-            double sin_of = angle.sin();
-            double cos_of = angle.cos();
-            return Vector2((x * cos_of) - (y * sin_of), (x * sin_of) + (y * cos_of));
+            Sin_cos sin_cos = angle.sincos();
+            return Vector2((x * sin_cos.cos) - (y * sin_cos.sin), (x * sin_cos.sin) + (y * sin_cos.cos));
         }
 
         /**
@@ -220,7 +231,8 @@ namespace gf
         */
         Vector2 get_abs() const
         {
-            return Vector2(std::abs(x), std::abs(y));
+            using std::abs;
+            return Vector2(abs(x), abs(y));
         }
 
         /**
@@ -272,7 +284,8 @@ namespace gf
         */
         std::string get_string() const
         {
-	        return "Vector2(" + std::to_string(x) + ", " + std::to_string(y) + ")";
+            using std::to_string;
+	        return "Vector2(" + to_string(x) + ", " + to_string(y) + ")";
         }
 
 
@@ -451,9 +464,17 @@ namespace gf
     using Vector2i = Vector2<int> ; // A vector with int components
 
     template <typename Vector_type>
-    constexpr inline Vector2<Vector_type> Vector2<Vector_type>::from_angle(const Angle& angle)
+    inline Vector2<Vector_type> Vector2<Vector_type>::from_angle(const Angle& angle)
+    {
+        Sin_cos sin_cos = angle.sincos();
+        return Vector2<Vector_type>{static_cast<Vector_type>(sin_cos.cos), static_cast<Vector_type>(sin_cos.sin)};
+    }
+
+    template <typename Vector_type>
+    constexpr inline Vector2<Vector_type> Vector2<Vector_type>::from_angle(const Angle& angle, Trig_precision precision)
     {
-        return Vector2<Vector_type>{static_cast<Vector_type>(angle.cos()), static_cast<Vector_type>(angle.sin())};
+        Sin_cos sin_cos = angle.sincos(precision);
+        return Vector2<Vector_type>{static_cast<Vector_type>(sin_cos.cos), static_cast<Vector_type>(sin_cos.sin)};
     }
 
 };
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include "Angle.hpp"
+#include "Matrix2x3.hpp"
+#include "Vector2.hpp"
+
+namespace gf::batch
+{
+    /**
+     * Vector math over whole arrays, a SIMD pack of vectors at a time.
+     *
+     * Every operation comes in two layouts: separate x and y arrays, which is the fastest, and
+     * arrays of Vector2f, which are split into x and y in blocks on the stack. Outputs may alias
+     * inputs of the same layout.
+     *
+     * Results match the Vector2f methods: lengths, normalization, dot and cross products use the
+     * same operations and agree exactly unless the compiler contracts them into fused multiply adds,
+     * which changes the last bit. Rotation by one angle agrees with get_rotated the same way.
+     *
+     * Rotation by an angle per vector takes a Trig_precision. The exact tier calls the standard
+     * library for every angle, the polynomial tiers compute the sine and cosine of a whole pack at
+     * once and match Angle::sincos of the same precision to within an ulp.
+    */
+
+    /**
+     * @brief Rotate vectors about the origin
+    */
+    void rotate(const float* x, const float* y, float* result_x, float* result_y, std::size_t count, const Angle& angle);
+    void rotate(const Vector2f* vectors, Vector2f* result, std::size_t count, const Angle& angle);
+
+    /**
+     * @brief Rotate each vector about the origin by its own angle
+     *
+     * @param radians The angle of each vector in radians
+    */
+    void rotate(const float* x, const float* y, const float* radians, float* result_x, float* result_y, std::size_t count, Trig_precision precision = Trig_precision::high);
+    void rotate(const Vector2f* vectors, const float* radians, Vector2f* result, std::size_t count, Trig_precision precision = Trig_precision::high);
+
+    /**
+     * @brief Get the sines and cosines of angles in radians
+    */
+    void get_sin_cos(const float* radians, float* sines, float* cosines, std::size_t count, Trig_precision precision = Trig_precision::high);
+
+    /**
+     * @brief Transform points by an affine matrix
+    */
+    void transform(const float* x, const float* y, float* result_x, float* result_y, std::size_t count, const Matrix2x3& matrix);
+    void transform(const Vector2f* points, Vector2f* result, std::size_t count, const Matrix2x3& matrix);
+
+    /**
+     * @brief Add an offset to vectors
+    */
+    void translate(const float* x, const float* y, float* result_x, float* result_y, std::size_t count, const Vector2f& offset);
+    void translate(const Vector2f* vectors, Vector2f* result, std::size_t count, const Vector2f& offset);
+
+    /**
+     * @brief Multiply vectors component wise by a scale
+    */
+    void scale(const float* x, const float* y, float* result_x, float* result_y, std::size_t count, const Vector2f& factors);
+    void scale(const Vector2f* vectors, Vector2f* result, std::size_t count, const Vector2f& factors);
+
+    /**
+     * @brief Scale vectors to a length of one, zero vectors stay zero
+    */
+    void normalize(const float* x, const float* y, float* result_x, float* result_y, std::size_t count);
+    void normalize(const Vector2f* vectors, Vector2f* result, std::size_t count);
+
+    /**
+     * @brief Get the lengths of vectors
+    */
+    void get_lengths(const float* x, const float* y, float* lengths, std::size_t count);
+    void get_lengths(const Vector2f* vectors, float* lengths, std::size_t count);
+
+    /**
+     * @brief Get the dot products of pairs of vectors
+    */
+    void get_dot_products(const float* a_x, const float* a_y, const float* b_x, const float* b_y, float* result, std::size_t count);
+    void get_dot_products(const Vector2f* a, const Vector2f* b, float* result, std::size_t count);
+
+    /**
+     * @brief Get the cross products of pairs of vectors, a.x * b.y - a.y * b.x
+    */
+    void get_cross_products(const float* a_x, const float* a_y, const float* b_x, const float* b_y, float* result, std::size_t count);
+    void get_cross_products(const Vector2f* a, const Vector2f* b, float* result, std::size_t count);
+
+    /**
+     * @brief Interpolate between arrays of floats, start + (end - start) * t, giving end exactly where t is 1
+    */
+    void lerp(const float* start, const float* end, const float* t, float* result, std::size_t count);
+
+} // namespace gf::batch
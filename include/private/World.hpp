@@ -0,0 +1,156 @@
+#pragma once
+
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include "Component_store.hpp"
+#include "Game_object.hpp"
+#include "Game_object_component.hpp"
+#include "Object_pool.hpp"
+#include "Scene_graph.hpp"
+
+namespace gf
+{
+    /**
+     * @brief Owns game objects and their components, allocating them from pools
+     *
+     * Objects spawned by a world are destroyed by the world: despawning an object destroys its whole
+     * subtree and its components, and clearing the world tears down every object at once, which is
+     * meant for level transitions. The pools keep their memory after a clear, so the next level is
+     * spawned without allocating.
+    */
+    class World
+    {
+        public:
+            World() = default;
+
+            /**
+             * @brief Construct a world whose objects store their transforms in a scene graph
+             *
+             * @param scene The scene graph, which must outlive the world
+            */
+            explicit World(Scene_graph& scene);
+
+            World(const World&) = delete;
+            World& operator=(const World&) = delete;
+
+            ~World();
+
+            /**
+             * @brief Create a new object
+             *
+             * @param parent The parent of the new object, or nullptr to create a root
+             * @return The new object
+            */
+            Game_object* spawn(Game_object* parent = nullptr);
+
+            /**
+             * @brief Destroy an object spawned by this world, along with its descendants and their components
+             *
+             * Descendants that were not spawned by this world are detached and become roots instead.
+             *
+             * @throws std::invalid_argument If the object was not spawned by this world, before anything is destroyed
+            */
+            void despawn(Game_object* object);
+
+            /**
+             * @brief Construct a component from the pool of its type and add it to an object
+             *
+             * The component is constructed from the owner followed by the arguments if it can be,
+             * otherwise from the arguments alone.
+             *
+             * @return The new component, owned by the world
+            */
+            template <typename Component, typename... Args>
+            Component* add_component(Game_object& owner, Args&&... args)
+            {
+                static_assert(std::is_base_of_v<Game_object_component, Component>, "Pooled components must derive from Game_object_component");
+
+                auto& pool = get_component_pool<Component>();
+                Component* component;
+                if constexpr (std::is_constructible_v<Component, Game_object&, Args...>)
+                    component = pool.create(owner, std::forward<Args>(args)...);
+                else
+                    component = pool.create(std::forward<Args>(args)...);
+
+                owner.add_component(component);
+                return component;
+            }
+
+            /**
+             * @brief Get the type-bucketed component stores of the objects of this world
+             *
+             * Components in the stores are removed when their owner is despawned.
+            */
+            Component_registry& get_components();
+
+            /**
+             * @brief Destroy every object and component of the world at once
+             *
+             * Objects of the world are not unlinked from each other one by one and no memory is returned
+             * to the heap. Objects outside the world that are parents or children of its objects are
+             * detached from them, as when the objects are despawned. Pools of trivially destructible
+             * components are reset in constant time, but every object is still visited once to free
+             * its handle, so that handles to it resolve to nullptr, and to find components that were
+             * not allocated from a pool, so clearing is linear in the number of objects and components.
+            */
+            void clear();
+
+            /**
+             * @brief Get the number of live objects
+            */
+            std::size_t size() const;
+
+        private:
+            class Component_pool_base
+            {
+                public:
+                    virtual ~Component_pool_base() = default;
+                    virtual bool owns(const Game_object_component* component) const = 0;
+                    virtual void destroy(Game_object_component* component) = 0;
+                    virtual void clear() = 0;
+            };
+
+            template <typename Component>
+            class Component_pool : public Component_pool_base
+            {
+                public:
+                    Object_pool<Component> pool;
+
+                    bool owns(const Game_object_component* component) const override
+                    {
+                        return pool.owns(component);
+                    }
+
+                    void destroy(Game_object_component* component) override
+                    {
+                        pool.destroy(static_cast<Component*>(component));
+                    }
+
+                    void clear() override
+                    {
+                        pool.clear();
+                    }
+            };
+
+            template <typename Component>
+            Object_pool<Component>& get_component_pool()
+            {
+                auto& pool = component_pools[typeid(Component)];
+                if (!pool)
+                    pool = std::make_unique<Component_pool<Component>>();
+                return static_cast<Component_pool<Component>&>(*pool).pool;
+            }
+
+            void release_component(Game_object_component* component);
+
+            Scene_graph* scene = nullptr;
+            Object_pool<Game_object> objects;
+            std::unordered_map<std::type_index, std::unique_ptr<Component_pool_base>> component_pools;
+            Component_registry components;
+    };
+
+} // namespace gf
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <memory>
 #include <optional> 
 
 #include "../Game_object.hpp"
 #include "../Game_object_component.hpp"
 #include "../Transform2.hpp"
+#include "../Easing_table.hpp"
 #include "../Process.hpp"
 #include "../Interpolation.hpp"
+#include "../Spline_path.hpp"
 
 namespace gf::component
 {
@@ -18,10 +21,42 @@ namespace gf::component
 
             void update(const gf::Time& dt) override;
 
-            void set_target_position(const gf::Transform2& target_position, gf::Time duration, gf::Easing_function interpolation = gf::easing::linear);
+            /**
+             * @brief Move the owner to a target transform over a duration, replacing any path being followed
+             *
+             * Custom easing functions are sampled into an Easing_table, built in ones are evaluated exactly.
+            */
+            void set_target_position(const gf::Transform2& target_position, gf::Time duration, gf::Easing_function interpolation = gf::Easing_type::linear);
+
+            /**
+             * @brief Move the owner along a path at a constant speed, replacing any target position
+             *
+             * The path must outlive the solver or be stopped with stop_following_path. To move many
+             * objects along the same path, a Path_follower_group evaluates them in one batch.
+             *
+             * @param path The path to follow
+             * @param speed The distance to move along the path per second, negative to move back towards the start
+             * @param loop Whether to start again from the beginning after reaching the end, otherwise following stops there
+             * @param orient Whether to rotate the owner to face along the path
+            */
+            void follow_path(const gf::Spline_path& path, float speed, bool loop = false, bool orient = false);
+
+            void stop_following_path();
+
+            bool get_following_path() const;
+
+            /**
+             * @brief Get the distance travelled along the path being followed
+            */
+            float get_path_distance() const;
 
         private:
-            Game_object& game_object;
             std::optional<gf::Transform_linear_process> process;
+            std::unique_ptr<gf::Easing_table> custom_easing; ///< The sampled custom easing of the process, so that it does not move
+            const gf::Spline_path* path = nullptr;
+            float path_distance = 0.0f;
+            float path_speed = 0.0f;
+            bool path_loop = false;
+            bool path_orient = false;
     };
 } // namespace gf::component
@@ -1,11 +1,36 @@
 #include "../../private/Utilities.hpp"
 #include "../../private/Vector2.hpp"
+#include "../../private/Vector2_batch.hpp"
 #include "../../private/Angle.hpp"
+#include "../../private/Constexpr_math.hpp"
+#include "../../private/Directions.hpp"
+#include "../../private/Matrix2x3.hpp"
 #include "../../private/Transform2.hpp"
+#include "../../private/Fixed.hpp"
+#include "../../private/Fixed_angle.hpp"
+#include "../../private/Fixed_transform2.hpp"
 #include "../../private/Interpolation.hpp"
+#include "../../private/Easing_table.hpp"
 #include "../../private/Aabb.hpp"
 #include "../../private/Process.hpp"
+#include "../../private/Tween_manager.hpp"
+#include "../../private/Track.hpp"
+#include "../../private/Spline_path.hpp"
 #include "../../private/Time.hpp"
+#include "../../private/Timer_service.hpp"
+#include "../../private/Handle.hpp"
+#include "../../private/Inplace_function.hpp"
+#include "../../private/Job_system.hpp"
+#include "../../private/Scene_graph.hpp"
 #include "../../private/Game_object.hpp"
 #include "../../private/Game_object_component.hpp"
+#include "../../private/Path_follower_group.hpp"
+#include "../../private/Position_solver_system.hpp"
+#include "../../private/Component_store.hpp"
+#include "../../private/Object_pool.hpp"
+#include "../../private/World.hpp"
+#include "../../private/Command_buffer.hpp"
+#include "../../private/Fixed_step_driver.hpp"
+#include "../../private/Profiler.hpp"
+#include "../../private/Trace.hpp"
 #include "../../private/State_machine.hpp"
\ No newline at end of file
@@ -14,6 +14,16 @@ Angle Angle::get_mod(const Angle& angle) const
     return Angle{std::fmod(radians, angle.radians)}; 
 }
 
+void gf::wrap_shortest_path(float& start_radians, float& end_radians)
+{
+    start_radians = std::fmod(start_radians, TWO_PI.get_radians());
+    end_radians = std::fmod(end_radians, TWO_PI.get_radians());
+    if (start_radians - end_radians > PI.get_radians())
+        end_radians += TWO_PI.get_radians();
+    if (start_radians - end_radians < -PI.get_radians())
+        end_radians -= TWO_PI.get_radians();
+}
+
 std::string Angle::get_string() const
 {
     return std::to_string(get_degrees()) + "_deg";
@@ -31,6 +41,11 @@ float Angle::cos() const
     return std::cosf(radians);
 }
 
+Sin_cos Angle::sincos() const
+{
+    return {std::sin(radians), std::cos(radians)};
+}
+
 float Angle::tan() const
 {
     return std::tanf(radians);
@@ -52,66 +67,6 @@ float Angle::atan() const
 }
 
 
-/* Arithmetic Operators */
-
-Angle Angle::operator+(const Angle& other) const
-{
-    return Angle{radians + other.radians};
-}
-
-Angle Angle::operator-(const Angle& other) const
-{
-    return Angle{radians - other.radians};
-}
-
-Angle Angle::operator-() const
-{
-    return Angle{-radians};
-}
-
-Angle Angle::operator*(const float scalar) const
-{
-    return Angle{radians * scalar};
-}
-
-Angle Angle::operator/(const float scalar) const
-{
-    return Angle{radians / scalar};
-}
-
-Angle& Angle::operator+=(const Angle& other)
-{
-    radians += other.radians;
-    return *this;
-}
-
-Angle& Angle::operator-=(const Angle& other)
-{
-    radians -= other.radians;
-    return *this;
-}
-
-Angle& Angle::operator*=(const float scalar)
-{
-    radians *= scalar;
-    return *this;
-}
-
-Angle& Angle::operator/=(const float scalar)
-{
-    radians /= scalar;
-    return *this;
-}
-
-/* Comparison Operators*/
-
-bool Angle::operator==(const Angle& other) const { return radians == other.radians; }
-bool Angle::operator!=(const Angle& other) const { return !(*this == other); }
-bool Angle::operator<(const Angle& other) const { return radians < other.radians; }
-bool Angle::operator>(const Angle& other) const { return radians > other.radians; }
-bool Angle::operator<=(const Angle& other) const { return !(*this > other); }
-bool Angle::operator>=(const Angle& other) const { return !(*this < other); }
-
 /* Printing utilities */
 
 std::ostream& operator<<(std::ostream& os, const Angle& angle)
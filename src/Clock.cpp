@@ -1,4 +1,5 @@
 #include "Clock.hpp"
+#include "Profiler.hpp"
 
 using namespace gf;
 
@@ -8,13 +9,13 @@ Clock::Clock(const Time& length):
     callback{}
 {}
 
-gf::Clock::Clock(const Time &length, const std::function<void()> &new_callback):
+gf::Clock::Clock(const Time &length, const Inplace_function<void()> &new_callback):
     length{length.get_milliseconds()},
     elapsed{},
     callback{new_callback}
 {}
 
-gf::Clock::Clock(const Time &length, const Time &elapsed, const std::function<void()> &new_callback):
+gf::Clock::Clock(const Time &length, const Time &elapsed, const Inplace_function<void()> &new_callback):
     length{length},
     elapsed{elapsed},
     callback{new_callback}
@@ -66,11 +67,12 @@ void Clock::tick(const Time& delta_time)
     elapsed += delta_time;
     if (elapsed >= length && callback)
     {
+        GF_PROFILE_SCOPE("Clock::callback");
         callback();
     }
 }
 
-void gf::Clock::add_callback(const std::function<void()> &new_callback)
+void gf::Clock::add_callback(const Inplace_function<void()> &new_callback)
 {
     callback = new_callback;
 }
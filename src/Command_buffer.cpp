@@ -0,0 +1,166 @@
+#include "Command_buffer.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+using namespace gf;
+
+Command_buffer::Command_buffer(World& world):
+    world{world}
+{}
+
+void Command_buffer::spawn(Game_object_handle parent, Initializer initializer)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    spawns.push_back({parent, std::move(initializer)});
+}
+
+void Command_buffer::reparent(Game_object_handle child, Game_object_handle new_parent)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    reparents.push_back({child, new_parent});
+}
+
+void Command_buffer::destroy(Game_object_handle object)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    destroys.push_back(object);
+}
+
+void Command_buffer::record_component(Game_object_handle owner, Component_factory factory)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    component_additions.push_back({owner, std::move(factory)});
+}
+
+bool Command_buffer::empty() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return spawns.empty() && reparents.empty() && component_additions.empty() && destroys.empty();
+}
+
+void Command_buffer::apply()
+{
+    // Commands recorded while applying, by initializers for example, are left for the next batch
+    std::vector<Spawn_command> pending_spawns;
+    std::vector<Reparent_command> pending_reparents;
+    std::vector<Component_command> pending_components;
+    std::vector<Game_object_handle> pending_destroys;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending_spawns.swap(spawns);
+        pending_reparents.swap(reparents);
+        pending_components.swap(component_additions);
+        pending_destroys.swap(destroys);
+    }
+
+    // The commands before these have been applied, or were being applied when something threw
+    std::size_t next_spawn = 0;
+    std::size_t next_reparent = 0;
+    std::size_t next_component = 0;
+    std::size_t next_destroy = 0;
+
+    try
+    {
+        std::stable_sort(pending_spawns.begin(), pending_spawns.end(), [](const Spawn_command& a, const Spawn_command& b)
+        {
+            return a.parent < b.parent;
+        });
+
+        for (auto run = pending_spawns.begin(); run != pending_spawns.end();)
+        {
+            auto run_end = std::find_if(run, pending_spawns.end(), [&run](const Spawn_command& command) { return command.parent != run->parent; });
+
+            Game_object* parent = run->parent.get();
+            if (parent || run->parent.is_null())
+            {
+                if (parent)
+                    parent->children.reserve(parent->children.size() + (run_end - run));
+
+                for (auto command = run; command != run_end; ++command)
+                {
+                    next_spawn = (command - pending_spawns.begin()) + 1;
+                    Game_object* object = world.spawn(parent);
+                    if (command->initializer)
+                        command->initializer(*object);
+                }
+            }
+            run = run_end;
+            next_spawn = run - pending_spawns.begin();
+        }
+
+        // Only the last reparent recorded for a child counts, the sort by child keeps the recorded order
+        std::stable_sort(pending_reparents.begin(), pending_reparents.end(), [](const Reparent_command& a, const Reparent_command& b)
+        {
+            return a.child < b.child;
+        });
+        auto last = std::unique(pending_reparents.rbegin(), pending_reparents.rend(), [](const Reparent_command& a, const Reparent_command& b)
+        {
+            return a.child == b.child;
+        });
+        pending_reparents.erase(pending_reparents.begin(), last.base());
+
+        std::stable_sort(pending_reparents.begin(), pending_reparents.end(), [](const Reparent_command& a, const Reparent_command& b)
+        {
+            return a.new_parent < b.new_parent;
+        });
+
+        for (auto& command : pending_reparents)
+        {
+            ++next_reparent;
+            Game_object* child = command.child.get();
+            if (!child)
+                continue;
+
+            if (command.new_parent.is_null())
+            {
+                if (Game_object* old_parent = child->parent.get())
+                    old_parent->remove_child(child);
+            }
+            else if (Game_object* new_parent = command.new_parent.get())
+            {
+                new_parent->add_child(child);
+            }
+        }
+
+        std::stable_sort(pending_components.begin(), pending_components.end(), [](const Component_command& a, const Component_command& b)
+        {
+            return a.owner < b.owner;
+        });
+
+        for (auto run = pending_components.begin(); run != pending_components.end();)
+        {
+            auto run_end = std::find_if(run, pending_components.end(), [&run](const Component_command& command) { return command.owner != run->owner; });
+
+            if (Game_object* owner = run->owner.get())
+            {
+                owner->components.reserve(owner->components.size() + (run_end - run));
+                for (auto command = run; command != run_end; ++command)
+                {
+                    next_component = (command - pending_components.begin()) + 1;
+                    command->factory(world, *owner);
+                }
+            }
+            run = run_end;
+            next_component = run - pending_components.begin();
+        }
+
+        // Destroying a parent destroys its subtree, so later handles in the list may already be stale
+        for (auto& handle : pending_destroys)
+        {
+            ++next_destroy;
+            if (Game_object* object = handle.get())
+                world.despawn(object);
+        }
+    }
+    catch (...)
+    {
+        // The command that threw is dropped, the ones after it go back ahead of any recorded since
+        std::lock_guard<std::mutex> lock(mutex);
+        spawns.insert(spawns.begin(), std::make_move_iterator(pending_spawns.begin() + next_spawn), std::make_move_iterator(pending_spawns.end()));
+        reparents.insert(reparents.begin(), pending_reparents.begin() + next_reparent, pending_reparents.end());
+        component_additions.insert(component_additions.begin(), std::make_move_iterator(pending_components.begin() + next_component), std::make_move_iterator(pending_components.end()));
+        destroys.insert(destroys.begin(), pending_destroys.begin() + next_destroy, pending_destroys.end());
+        throw;
+    }
+}
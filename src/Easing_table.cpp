@@ -0,0 +1,66 @@
+#include "Easing_table.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace gf;
+
+Easing_table::Easing_table(const Easing_function& function, std::size_t sample_count):
+    scale{static_cast<float>(sample_count) - 1.0f},
+    max_error{0.0f}
+{
+    if (sample_count < 2)
+    {
+        throw std::invalid_argument("An easing table needs at least two samples");
+    }
+
+    samples.resize(sample_count + 1);
+    for (std::size_t i = 0; i < sample_count; ++i)
+    {
+        samples[i] = function(static_cast<float>(i) / scale);
+    }
+    samples[sample_count] = samples[sample_count - 1];
+
+    // Linear interpolation is exact at the samples, so the error is measured between them
+    constexpr std::size_t checks_per_interval = 16;
+    for (std::size_t i = 0; i + 1 < sample_count; ++i)
+    {
+        for (std::size_t j = 1; j < checks_per_interval; ++j)
+        {
+            float t = (static_cast<float>(i) + static_cast<float>(j) / checks_per_interval) / scale;
+            max_error = std::max(max_error, std::fabs((*this)(t) - function(t)));
+        }
+    }
+}
+
+void Easing_table::evaluate(const float* t, float* result, std::size_t count) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        result[i] = (*this)(t[i]);
+    }
+}
+
+std::size_t Easing_table::get_sample_count() const
+{
+    return samples.size() - 1;
+}
+
+float Easing_table::get_max_error() const
+{
+    return max_error;
+}
+
+const Easing_table& easing::get_table(Easing_type type)
+{
+    static const std::vector<Easing_table> tables = []()
+    {
+        std::vector<Easing_table> built;
+        built.reserve(easing_type_count);
+        for (std::size_t i = 0; i < easing_type_count; ++i)
+            built.emplace_back(static_cast<Easing_type>(i));
+        return built;
+    }();
+    return tables[static_cast<std::size_t>(type)];
+}
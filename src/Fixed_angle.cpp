@@ -0,0 +1,99 @@
+#include "Fixed_angle.hpp"
+
+#include <cmath>
+
+using namespace gf;
+
+namespace
+{
+    /**
+     * @brief sin(i * pi / 512) in Q16.16 for the 257 steps of a quarter turn
+     *
+     * Written out rather than computed at startup so it cannot depend on the libm it was built
+     * with. The last entry repeats the peak so that interpolating at a quarter turn stays in bounds.
+    */
+    constexpr std::int32_t quarter_sines[258] = {
+        0, 402, 804, 1206, 1608, 2010, 2412, 2814, 3216, 3617, 4019, 4420,
+        4821, 5222, 5623, 6023, 6424, 6824, 7224, 7623, 8022, 8421, 8820, 9218,
+        9616, 10014, 10411, 10808, 11204, 11600, 11996, 12391, 12785, 13180, 13573, 13966,
+        14359, 14751, 15143, 15534, 15924, 16314, 16703, 17091, 17479, 17867, 18253, 18639,
+        19024, 19409, 19792, 20175, 20557, 20939, 21320, 21699, 22078, 22457, 22834, 23210,
+        23586, 23961, 24335, 24708, 25080, 25451, 25821, 26190, 26558, 26925, 27291, 27656,
+        28020, 28383, 28745, 29106, 29466, 29824, 30182, 30538, 30893, 31248, 31600, 31952,
+        32303, 32652, 33000, 33347, 33692, 34037, 34380, 34721, 35062, 35401, 35738, 36075,
+        36410, 36744, 37076, 37407, 37736, 38064, 38391, 38716, 39040, 39362, 39683, 40002,
+        40320, 40636, 40951, 41264, 41576, 41886, 42194, 42501, 42806, 43110, 43412, 43713,
+        44011, 44308, 44604, 44898, 45190, 45480, 45769, 46056, 46341, 46624, 46906, 47186,
+        47464, 47741, 48015, 48288, 48559, 48828, 49095, 49361, 49624, 49886, 50146, 50404,
+        50660, 50914, 51166, 51417, 51665, 51911, 52156, 52398, 52639, 52878, 53114, 53349,
+        53581, 53812, 54040, 54267, 54491, 54714, 54934, 55152, 55368, 55582, 55794, 56004,
+        56212, 56418, 56621, 56823, 57022, 57219, 57414, 57607, 57798, 57986, 58172, 58356,
+        58538, 58718, 58896, 59071, 59244, 59415, 59583, 59750, 59914, 60075, 60235, 60392,
+        60547, 60700, 60851, 60999, 61145, 61288, 61429, 61568, 61705, 61839, 61971, 62101,
+        62228, 62353, 62476, 62596, 62714, 62830, 62943, 63054, 63162, 63268, 63372, 63473,
+        63572, 63668, 63763, 63854, 63944, 64031, 64115, 64197, 64277, 64354, 64429, 64501,
+        64571, 64639, 64704, 64766, 64827, 64884, 64940, 64993, 65043, 65091, 65137, 65180,
+        65220, 65259, 65294, 65328, 65358, 65387, 65413, 65436, 65457, 65476, 65492, 65505,
+        65516, 65525, 65531, 65535, 65536, 65536
+    };
+
+    constexpr int position_bits = 30; ///< Bits of the angle below the quadrant
+    constexpr int index_bits = 8;
+    constexpr int fraction_bits = 16; ///< Bits of the position kept for interpolation
+
+    /**
+     * @brief The sine of a position in a quarter turn, from 0 to 2^30 inclusive
+    */
+    std::int32_t quarter_sine(std::uint32_t position)
+    {
+        std::uint32_t index = position >> (position_bits - index_bits);
+        std::int64_t fraction = (position >> (position_bits - index_bits - fraction_bits)) & ((1u << fraction_bits) - 1);
+        std::int32_t low = quarter_sines[index];
+        std::int32_t high = quarter_sines[index + 1];
+        return low + static_cast<std::int32_t>(((high - low) * fraction + (std::int64_t{1} << (fraction_bits - 1))) >> fraction_bits);
+    }
+}
+
+Fixed_angle Fixed_angle::from_angle(const Angle& angle)
+{
+    double turn_fraction = static_cast<double>(angle.get_radians()) / (2.0 * 3.14159265358979323846);
+    turn_fraction -= std::floor(turn_fraction);
+    // A fraction that rounds up to a whole turn wraps to zero in the conversion to 32 bits
+    return from_raw(static_cast<Raw>(static_cast<std::uint64_t>(turn_fraction * 4294967296.0 + 0.5)));
+}
+
+Angle Fixed_angle::get_angle() const
+{
+    return Angle{static_cast<double>(turns) * (2.0 * 3.14159265358979323846 / 4294967296.0)};
+}
+
+std::string Fixed_angle::get_string() const
+{
+    return to_string(get_degrees()) + "_deg";
+}
+
+Fixed Fixed_angle::sin() const
+{
+    return sincos().sin;
+}
+
+Fixed Fixed_angle::cos() const
+{
+    return sincos().cos;
+}
+
+Fixed_sin_cos Fixed_angle::sincos() const
+{
+    constexpr std::uint32_t quarter = 1u << position_bits;
+    std::uint32_t position = turns & (quarter - 1);
+    Fixed sin_of = Fixed::from_raw(quarter_sine(position));
+    Fixed cos_of = Fixed::from_raw(quarter_sine(quarter - position));
+
+    switch (turns >> position_bits)
+    {
+        case 0: return {sin_of, cos_of};
+        case 1: return {cos_of, -sin_of};
+        case 2: return {-sin_of, -cos_of};
+        default: return {-cos_of, sin_of};
+    }
+}
@@ -0,0 +1,138 @@
+#include "Fixed_step_driver.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace gf;
+
+Fixed_step_driver::Fixed_step_driver(const Time& step, std::size_t max_steps_per_frame):
+    step{step},
+    max_steps_per_frame{max_steps_per_frame}
+{
+    if (step <= Time())
+    {
+        throw std::invalid_argument("Step length must be positive");
+    }
+}
+
+std::size_t Fixed_step_driver::advance(const Time& frame_time, const Step_function& step_function)
+{
+    accumulator += frame_time;
+
+    std::size_t steps = 0;
+    while (accumulator >= step && steps < max_steps_per_frame)
+    {
+        store_previous_transforms();
+        step_function(step);
+        accumulator -= step;
+        ++steps;
+        ++step_count;
+    }
+
+    // Catching up would take even longer next frame, so the excess is dropped
+    if (accumulator >= step)
+    {
+        Time excess{std::fmod(accumulator.get_milliseconds(), step.get_milliseconds())};
+        dropped_time += accumulator - excess;
+        accumulator = excess;
+    }
+
+    return steps;
+}
+
+std::size_t Fixed_step_driver::advance(const Time& frame_time, Game_object& root)
+{
+    // Global transforms are brought up to date after every step, before they are stored as previous
+    root.update_position();
+    return advance(frame_time, [&root](const Time& dt)
+    {
+        root.update(dt);
+        root.update_position();
+    });
+}
+
+std::size_t Fixed_step_driver::advance(const Time& frame_time, Game_object& root, Job_system& jobs)
+{
+    root.update_position();
+    return advance(frame_time, [&root, &jobs](const Time& dt)
+    {
+        root.update(dt, jobs);
+        root.update_position();
+    });
+}
+
+void Fixed_step_driver::add_interpolated(Game_object& object)
+{
+    interpolated_objects.push_back(object.get_handle());
+    object.store_previous_transform();
+}
+
+void Fixed_step_driver::remove_interpolated(const Game_object& object)
+{
+    interpolated_objects.erase(std::remove(interpolated_objects.begin(), interpolated_objects.end(), object.get_handle()), interpolated_objects.end());
+}
+
+void Fixed_step_driver::add_interpolated(Scene_graph& scene)
+{
+    interpolated_scenes.push_back(&scene);
+    scene.store_previous_transforms();
+}
+
+void Fixed_step_driver::remove_interpolated(const Scene_graph& scene)
+{
+    interpolated_scenes.erase(std::remove(interpolated_scenes.begin(), interpolated_scenes.end(), &scene), interpolated_scenes.end());
+}
+
+Transform2 Fixed_step_driver::get_interpolated_transform(const Game_object& object) const
+{
+    return object.get_interpolated_transform(get_alpha());
+}
+
+float Fixed_step_driver::get_alpha() const
+{
+    return accumulator / step;
+}
+
+Time Fixed_step_driver::get_step() const
+{
+    return step;
+}
+
+void Fixed_step_driver::set_step(const Time& new_step)
+{
+    if (new_step <= Time())
+    {
+        throw std::invalid_argument("Step length must be positive");
+    }
+    step = new_step;
+}
+
+std::uint64_t Fixed_step_driver::get_step_count() const
+{
+    return step_count;
+}
+
+Time Fixed_step_driver::get_dropped_time() const
+{
+    return dropped_time;
+}
+
+void Fixed_step_driver::store_previous_transforms()
+{
+    for (Scene_graph* scene : interpolated_scenes)
+    {
+        scene->update_transforms();
+        scene->store_previous_transforms();
+    }
+
+    // Destroyed objects are forgotten as they are found
+    auto end = std::remove_if(interpolated_objects.begin(), interpolated_objects.end(), [](const Game_object_handle& handle)
+    {
+        Game_object* object = handle.get();
+        if (object)
+            object->store_previous_transform();
+        return object == nullptr;
+    });
+    interpolated_objects.erase(end, interpolated_objects.end());
+}
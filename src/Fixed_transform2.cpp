@@ -0,0 +1,88 @@
+#include "Fixed_transform2.hpp"
+
+using namespace gf;
+
+namespace
+{
+    /**
+     * @brief Scale then rotate a vector by a precomputed sine and cosine
+    */
+    Vector2x scale_and_rotate(const Vector2x& vector, const Vector2x& scale, const Fixed_sin_cos& sin_cos)
+    {
+        Fixed x = vector.x * scale.x;
+        Fixed y = vector.y * scale.y;
+        return Vector2x(x * sin_cos.cos - y * sin_cos.sin, x * sin_cos.sin + y * sin_cos.cos);
+    }
+}
+
+Transform2 Fixed_transform2::get_transform() const
+{
+    return Transform2(
+        Vector2f(position.x.get_float(), position.y.get_float()),
+        rotation.get_angle(),
+        Vector2f(scale.x.get_float(), scale.y.get_float())
+    );
+}
+
+std::string Fixed_transform2::get_string() const
+{
+    return "Fixed_transform(Position: " + position.get_string() + ", Rotation: " + rotation.get_string() + ", Scale: " + scale.get_string() + ")";
+}
+
+Fixed_transform2 Fixed_transform2::operator*(const Fixed_transform2& other) const
+{
+    return Fixed_transform2(transform_point(other.position), rotation + other.rotation, scale * other.scale);
+}
+
+Fixed_transform2& Fixed_transform2::operator*=(const Fixed_transform2& other)
+{
+    *this = *this * other;
+    return *this;
+}
+
+bool Fixed_transform2::operator==(const Fixed_transform2& other) const
+{
+    return position == other.position && rotation == other.rotation && scale == other.scale;
+}
+
+bool Fixed_transform2::operator!=(const Fixed_transform2& other) const
+{
+    return !(*this == other);
+}
+
+Vector2x Fixed_transform2::transform_point(const Vector2x& point) const
+{
+    return position + transform_vector(point);
+}
+
+Vector2x Fixed_transform2::transform_vector(const Vector2x& vector) const
+{
+    return scale_and_rotate(vector, scale, rotation.sincos());
+}
+
+void Fixed_transform2::transform_points(const Vector2x* points, Vector2x* result, std::size_t count) const
+{
+    Fixed_sin_cos sin_cos = rotation.sincos();
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = position + scale_and_rotate(points[i], scale, sin_cos);
+}
+
+void Fixed_transform2::translate(const Vector2x& offset)
+{
+    position += offset;
+}
+
+void Fixed_transform2::rotate(const Fixed_angle& angle)
+{
+    rotation += angle;
+}
+
+void Fixed_transform2::scale_by(const Vector2x& factors)
+{
+    scale *= factors;
+}
+
+std::ostream& gf::operator<<(std::ostream& os, const Fixed_transform2& transform)
+{
+    return os << transform.get_string();
+}
@@ -0,0 +1,347 @@
+#include "Game_object.hpp"
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <typeinfo>
+
+using namespace gf;
+
+Game_object::Game_object(Game_object* parent):
+    parent(parent ? parent->handle : Game_object_handle()),
+    handle(get_slot_table().insert(this))
+{}
+
+Game_object::Game_object(Scene_graph& scene, Game_object* parent):
+    parent(parent ? parent->handle : Game_object_handle()),
+    scene(&scene)
+{
+    if (parent && parent->scene != &scene)
+    {
+        throw std::invalid_argument("A game object must belong to the same scene graph as its parent");
+    }
+    node = scene.create_node(parent ? parent->node : Scene_graph::null_node);
+    handle = get_slot_table().insert(this);
+}
+
+Game_object::Game_object(Game_object&& other):
+    components(std::move(other.components)),
+    children(std::move(other.children)),
+    parent(other.parent),
+    handle(other.handle),
+    transform(other.transform),
+    anchor_point(other.anchor_point),
+    global_transform(other.global_transform),
+    previous_global_transform(other.previous_global_transform),
+    scene(other.scene),
+    node(other.node),
+    transform_dirty(other.transform_dirty),
+    children_dirty(other.children_dirty.load(std::memory_order_relaxed))
+{
+    if (!handle.is_null())
+        get_slot_table().set(handle, this);
+
+    other.components.clear();
+    other.children.clear();
+    other.parent = Game_object_handle();
+    other.handle = Game_object_handle();
+    other.scene = nullptr;
+    other.node = Scene_graph::null_node;
+}
+
+Game_object::~Game_object()
+{
+    for (auto& component : components)
+    {
+        delete component;
+    }
+
+    for (auto& child_handle : children)
+    {
+        if (Game_object* child = child_handle.get())
+        {
+            child->parent = Game_object_handle();
+            child->mark_transform_dirty();
+        }
+    }
+
+    if (Game_object* parent_object = parent.get())
+    {
+        auto& siblings = parent_object->children;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), handle), siblings.end());
+    }
+
+    if (scene)
+    {
+        scene->destroy_node(node);
+    }
+
+    get_slot_table().erase(handle);
+}
+
+Game_object_handle Game_object::get_handle() const
+{
+    return handle;
+}
+
+Game_object* Game_object::resolve(Game_object_handle handle)
+{
+    return get_slot_table().find(handle);
+}
+
+void Game_object::update(const gf::Time& dt)
+{
+    GF_PROFILE_SCOPE("Game_object::update");
+    update_position();
+    update_subtree(dt);
+}
+
+void Game_object::update(const gf::Time& dt, Job_system& jobs)
+{
+    GF_PROFILE_SCOPE("Game_object::update (jobs)");
+    update_position();
+    update_subtree(dt, jobs);
+}
+
+void Game_object::add_component(Game_object_component* component)
+{
+    components.push_back(component);
+    component->owner = handle;
+}
+
+void Game_object::add_child(Game_object* child)
+{
+    if (child->scene != scene)
+    {
+        throw std::invalid_argument("A game object must belong to the same scene graph as its parent");
+    }
+
+    if (scene)
+    {
+        scene->set_parent(child->node, node);
+    }
+
+    if (Game_object* old_parent = child->parent.get())
+    {
+        auto& siblings = old_parent->children;
+        siblings.erase(std::remove(siblings.begin(), siblings.end(), child->handle), siblings.end());
+    }
+
+    children.push_back(child->handle);
+    child->parent = handle;
+
+    if (!scene)
+        child->mark_transform_dirty();
+}
+
+void Game_object::remove_child(Game_object* child)
+{
+    children.erase(std::remove(children.begin(), children.end(), child->handle), children.end());
+    child->parent = Game_object_handle();
+
+    if (scene)
+        scene->set_parent(child->node, Scene_graph::null_node);
+    else
+        child->mark_transform_dirty();
+}
+
+void Game_object::update_components(const gf::Time& dt)
+{
+    GF_PROFILE_SCOPE("Game_object::update_components");
+    for (auto& component : components)
+    {
+        GF_PROFILE_SCOPE(typeid(*component).name());
+        component->update(dt);
+    }
+}
+
+void Game_object::update_position()
+{
+    GF_PROFILE_SCOPE("Game_object::update_position");
+    if (scene)
+    {
+        scene->update_transforms();
+        return;
+    }
+
+    if (!transform_dirty && !children_dirty)
+        return;
+
+    Game_object* parent_object = parent.get();
+    propagate_position(parent_object ? parent_object->get_child_anchor() : Transform2(), false);
+}
+
+const Transform2& Game_object::get_transform() const
+{
+    return scene ? scene->get_local_transform(node) : transform;
+}
+
+void Game_object::set_transform(const Transform2& new_transform)
+{
+    if (scene)
+    {
+        scene->set_local_transform(node, new_transform);
+        return;
+    }
+
+    transform = new_transform;
+    mark_transform_dirty();
+}
+
+const Vector2f& Game_object::get_anchor_point() const
+{
+    return scene ? scene->get_anchor_point(node) : anchor_point;
+}
+
+void Game_object::set_anchor_point(const Vector2f& new_anchor_point)
+{
+    if (scene)
+    {
+        scene->set_anchor_point(node, new_anchor_point);
+        return;
+    }
+
+    anchor_point = new_anchor_point;
+    mark_transform_dirty();
+}
+
+const Transform2& Game_object::get_global_transform() const
+{
+    return scene ? scene->get_global_transform(node) : global_transform;
+}
+
+void Game_object::store_previous_transform()
+{
+    if (scene)
+        scene->store_previous_transform(node);
+    else
+        previous_global_transform = global_transform;
+}
+
+const Transform2& Game_object::get_previous_global_transform() const
+{
+    return scene ? scene->get_previous_global_transform(node) : previous_global_transform;
+}
+
+Transform2 Game_object::get_interpolated_transform(float alpha) const
+{
+    return get_previous_global_transform().get_interpolated(get_global_transform(), alpha);
+}
+
+void Game_object::mark_transform_dirty()
+{
+    if (scene)
+    {
+        scene->mark_dirty(node);
+        return;
+    }
+
+    transform_dirty = true;
+
+    // Every ancestor of a flagged object is already flagged, so the walk can stop early
+    for (Game_object* ancestor = parent.get(); ancestor; ancestor = ancestor->parent.get())
+    {
+        if (ancestor->children_dirty.exchange(true, std::memory_order_relaxed))
+            break;
+    }
+}
+
+void Game_object::update_subtree(const gf::Time& dt)
+{
+    GF_TRACE_SCOPE("Game_object::update_subtree");
+    bool stale = false;
+    for (auto& child_handle : children)
+    {
+        if (Game_object* child = child_handle.get())
+            child->update_subtree(dt);
+        else
+            stale = true;
+    }
+    if (stale)
+        remove_stale_children();
+
+    update_components(dt);
+}
+
+void Game_object::update_subtree(const gf::Time& dt, Job_system& jobs)
+{
+    GF_TRACE_SCOPE("Game_object::update_subtree");
+    std::atomic<bool> stale{false};
+    if (children.size() > 1)
+    {
+        // A few chunks per thread leaves room for stealing when subtrees are uneven
+        std::size_t grain_size = children.size() / (4 * (jobs.get_worker_count() + 1));
+        jobs.parallel_for(children.size(), grain_size, [this, &dt, &jobs, &stale](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                if (Game_object* child = children[i].get())
+                    child->update_subtree(dt, jobs);
+                else
+                    stale.store(true, std::memory_order_relaxed);
+            }
+        });
+    }
+    else if (!children.empty())
+    {
+        if (Game_object* child = children.front().get())
+            child->update_subtree(dt, jobs);
+        else
+            stale.store(true, std::memory_order_relaxed);
+    }
+
+    // Only this object's task touches its child list, so it can be pruned here
+    if (stale.load(std::memory_order_relaxed))
+        remove_stale_children();
+
+    update_components(dt);
+}
+
+void Game_object::propagate_position(const Transform2& parent_anchor, bool force)
+{
+    force = force || transform_dirty;
+    if (force)
+    {
+        global_transform = parent_anchor * transform;
+    }
+
+    if (force || children_dirty)
+    {
+        Transform2 child_anchor = get_child_anchor();
+        bool stale = false;
+        for (auto& child_handle : children)
+        {
+            Game_object* child = child_handle.get();
+            if (!child)
+                stale = true;
+            else if (force || child->transform_dirty || child->children_dirty)
+            {
+                child->propagate_position(child_anchor, force);
+            }
+        }
+        if (stale)
+            remove_stale_children();
+    }
+
+    transform_dirty = false;
+    children_dirty.store(false, std::memory_order_relaxed);
+}
+
+void Game_object::remove_stale_children()
+{
+    children.erase(std::remove_if(children.begin(), children.end(), [](const Game_object_handle& child)
+    {
+        return !child.get();
+    }), children.end());
+}
+
+Transform2 Game_object::get_child_anchor() const
+{
+    return global_transform + global_transform.transform_vector(anchor_point);
+}
+
+Concurrent_slot_table<Game_object>& Game_object::get_slot_table()
+{
+    static Concurrent_slot_table<Game_object> slot_table;
+    return slot_table;
+}
@@ -0,0 +1,9 @@
+#include "Game_object_component.hpp"
+#include "Game_object.hpp"
+
+using namespace gf;
+
+void Game_object_component::set_owner(Game_object* owner)
+{
+    this->owner = owner ? owner->get_handle() : Game_object_handle();
+}
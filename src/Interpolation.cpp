@@ -1,166 +1,212 @@
 #include "Interpolation.hpp"
-#include "Angle.hpp"
-#include <cmath>
+#include "Simd.hpp"
 
 using namespace gf;
+using namespace gf::simd;
 
-float easing::linear(float t)
+void easing::evaluate(Easing_type type, const float* t, float* result, std::size_t count)
 {
-    return t;
+    switch (type)
+    {
+        #define GF_EASING_CASE(name) case Easing_type::name: batch::name(t, result, count); return;
+        GF_EASING_TYPES(GF_EASING_CASE)
+        #undef GF_EASING_CASE
+    }
 }
 
-float easing::in_quad(float t)
+namespace
 {
-    return t * t;
-}
+    const float half_pi = M_PI / 2;
 
-float easing::out_quad(float t)
-{
-    return t * (2 - t);
+    /**
+     * @brief Get cos(x) for x in [0, pi]
+    */
+    Float_pack cos_half_turn(Float_pack x)
+    {
+        return sin_half_period(splat(half_pi) - x);
+    }
 }
 
-float easing::in_out_quad(float t)
+void easing::batch::linear(const float* t, float* result, std::size_t count)
 {
-    if (t < 0.5f)
-    {
-        return 2 * t * t;
-    }
-    else
-    {
-        return -1 + (4 - 2 * t) * t;
-    }
+    if (t != result)
+        std::memmove(result, t, count * sizeof(float));
 }
 
-float easing::in_cubic(float t)
+void easing::batch::in_quad(const float* t, float* result, std::size_t count)
 {
-    return t * t * t;
+    transform([](Float_pack x) { return x * x; }, t, result, count);
 }
 
-float easing::out_cubic(float t)
+void easing::batch::out_quad(const float* t, float* result, std::size_t count)
 {
-    return (--t) * t * t + 1;
+    transform([](Float_pack x) { return x * (splat(2.0f) - x); }, t, result, count);
 }
 
-float easing::in_out_cubic(float t)
+void easing::batch::in_out_quad(const float* t, float* result, std::size_t count)
 {
-    if (t < 0.5f)
+    transform([](Float_pack x)
     {
-        return 4 * t * t * t;
-    }
-    else
-    {
-        return (t - 1) * (2 * t - 2) * (2 * t - 2) + 1;
-    }
+        Float_pack first = splat(2.0f) * x * x;
+        Float_pack second = mul_add(splat(4.0f) - splat(2.0f) * x, x, splat(-1.0f));
+        return select(x < splat(0.5f), first, second);
+    }, t, result, count);
 }
 
-float easing::in_quart(float t)
+void easing::batch::in_cubic(const float* t, float* result, std::size_t count)
 {
-    return t * t * t * t;
+    transform([](Float_pack x) { return x * x * x; }, t, result, count);
 }
 
-float easing::out_quart(float t)
+void easing::batch::out_cubic(const float* t, float* result, std::size_t count)
 {
-    return 1 - (--t) * t * t * t;
+    transform([](Float_pack x)
+    {
+        Float_pack u = x - splat(1.0f);
+        return mul_add(u * u, u, splat(1.0f));
+    }, t, result, count);
 }
 
-float easing::in_out_quart(float t)
+void easing::batch::in_out_cubic(const float* t, float* result, std::size_t count)
 {
-    if (t < 0.5f)
-    {
-        return 8 * t * t * t * t;
-    }
-    else
+    transform([](Float_pack x)
     {
-        return 1 - 8 * (--t) * t * t * t;
-    }
+        Float_pack first = splat(4.0f) * x * x * x;
+        Float_pack v = splat(2.0f) * x - splat(2.0f);
+        Float_pack second = mul_add((x - splat(1.0f)) * v, v, splat(1.0f));
+        return select(x < splat(0.5f), first, second);
+    }, t, result, count);
 }
 
-float easing::in_quint(float t)
+void easing::batch::in_quart(const float* t, float* result, std::size_t count)
 {
-    return t * t * t * t * t;
+    transform([](Float_pack x)
+    {
+        Float_pack x2 = x * x;
+        return x2 * x2;
+    }, t, result, count);
 }
 
-float easing::out_quint(float t)
+void easing::batch::out_quart(const float* t, float* result, std::size_t count)
 {
-    return 1 + (--t) * t * t * t * t;
+    transform([](Float_pack x)
+    {
+        Float_pack u = x - splat(1.0f);
+        Float_pack u2 = u * u;
+        return splat(1.0f) - u2 * u2;
+    }, t, result, count);
 }
 
-float easing::in_out_quint(float t)
+void easing::batch::in_out_quart(const float* t, float* result, std::size_t count)
 {
-    if (t < 0.5f)
+    transform([](Float_pack x)
     {
-        return 16 * t * t * t * t * t;
-    }
-    else
+        // Both halves are 8 * v^4 for some v, so one power serves both
+        Mask_pack first_half = x < splat(0.5f);
+        Float_pack v = select(first_half, x, x - splat(1.0f));
+        Float_pack v2 = v * v;
+        Float_pack power = splat(8.0f) * v2 * v2;
+        return select(first_half, power, splat(1.0f) - power);
+    }, t, result, count);
+}
+
+void easing::batch::in_quint(const float* t, float* result, std::size_t count)
+{
+    transform([](Float_pack x)
     {
-        return 1 + 16 * (--t) * t * t * t * t;
-    }
+        Float_pack x2 = x * x;
+        return x2 * x2 * x;
+    }, t, result, count);
 }
 
-float easing::in_sine(float t)
+void easing::batch::out_quint(const float* t, float* result, std::size_t count)
 {
-    return 1 - std::cos(t * M_PI * 2);
+    transform([](Float_pack x)
+    {
+        Float_pack u = x - splat(1.0f);
+        Float_pack u2 = u * u;
+        return mul_add(u2 * u2, u, splat(1.0f));
+    }, t, result, count);
 }
 
-float easing::out_sine(float t)
+void easing::batch::in_out_quint(const float* t, float* result, std::size_t count)
 {
-    return std::sin(t * M_PI / 2);
+    transform([](Float_pack x)
+    {
+        Mask_pack first_half = x < splat(0.5f);
+        Float_pack v = select(first_half, x, x - splat(1.0f));
+        Float_pack v2 = v * v;
+        Float_pack power = splat(16.0f) * v2 * v2 * v;
+        return select(first_half, power, power + splat(1.0f));
+    }, t, result, count);
 }
 
-float easing::in_out_sine(float t)
+void easing::batch::in_sine(const float* t, float* result, std::size_t count)
 {
-    return 0.5f * (1 - std::cos(t * M_PI));
+    transform([](Float_pack x) { return splat(1.0f) - cos_half_turn(x * splat(half_pi)); }, t, result, count);
 }
 
-float easing::in_expo(float t)
+void easing::batch::out_sine(const float* t, float* result, std::size_t count)
 {
-    return static_cast<float>((t == 0) ? 0 : std::pow(2, 10 * (t - 1)));
+    transform([](Float_pack x) { return sin_half_period(x * splat(half_pi)); }, t, result, count);
 }
 
-float easing::out_expo(float t)
+void easing::batch::in_out_sine(const float* t, float* result, std::size_t count)
 {
-    return static_cast<float>((t == 1) ? 1 : 1 - std::pow(2, -10 * t));
+    transform([](Float_pack x) { return splat(0.5f) * (splat(1.0f) - cos_half_turn(x * splat(M_PI))); }, t, result, count);
 }
 
-float easing::in_out_expo(float t)
+void easing::batch::in_expo(const float* t, float* result, std::size_t count)
 {
-    if (t == 0)
+    transform([](Float_pack x)
     {
-        return 0;
-    }
-    if (t == 1)
-    {
-        return 1;
-    }
-    if (t < 0.5f)
+        Float_pack power = exp2(splat(10.0f) * (x - splat(1.0f)));
+        return select(x == splat(0.0f), splat(0.0f), power);
+    }, t, result, count);
+}
+
+void easing::batch::out_expo(const float* t, float* result, std::size_t count)
+{
+    transform([](Float_pack x)
     {
-        return static_cast<float>(0.5f * std::pow(2, 20 * t - 10));
-    }
-    else
+        Float_pack power = splat(1.0f) - exp2(splat(-10.0f) * x);
+        return select(x == splat(1.0f), splat(1.0f), power);
+    }, t, result, count);
+}
+
+void easing::batch::in_out_expo(const float* t, float* result, std::size_t count)
+{
+    transform([](Float_pack x)
     {
-        return static_cast<float>(1 - 0.5f * std::pow(2, -20 * t + 10));
-    }
+        // The halves mirror each other, so one exponential serves both
+        Mask_pack first_half = x < splat(0.5f);
+        Float_pack exponent = mul_add(splat(20.0f), x, splat(-10.0f));
+        Float_pack power = splat(0.5f) * exp2(select(first_half, exponent, splat(0.0f) - exponent));
+        Float_pack eased = select(first_half, power, splat(1.0f) - power);
+        eased = select(x == splat(0.0f), splat(0.0f), eased);
+        return select(x == splat(1.0f), splat(1.0f), eased);
+    }, t, result, count);
 }
 
-float easing::in_circ(float t)
+void easing::batch::in_circ(const float* t, float* result, std::size_t count)
 {
-    return 1 - std::sqrt(1 - t * t);
+    transform([](Float_pack x) { return splat(1.0f) - sqrt(splat(1.0f) - x * x); }, t, result, count);
 }
 
-float easing::out_circ(float t)
+void easing::batch::out_circ(const float* t, float* result, std::size_t count)
 {
-    return std::sqrt((2 - t) * t);
+    transform([](Float_pack x) { return sqrt((splat(2.0f) - x) * x); }, t, result, count);
 }
 
-float easing::in_out_circ(float t)
+void easing::batch::in_out_circ(const float* t, float* result, std::size_t count)
 {
-    if (t < 0.5f)
-    {
-        return 0.5f * (1 - std::sqrt(1 - 4 * t * t));
-    }
-    else
+    transform([](Float_pack x)
     {
-        return 0.5f * (std::sqrt(-((2 * t - 3) * (2 * t - 1))) + 1);
-    }
+        // Selecting the radicand first keeps the other half's negative radicand out of the square root
+        Mask_pack first_half = x < splat(0.5f);
+        Float_pack first = splat(1.0f) - splat(4.0f) * x * x;
+        Float_pack second = (splat(3.0f) - splat(2.0f) * x) * (splat(2.0f) * x - splat(1.0f));
+        Float_pack root = sqrt(select(first_half, first, second));
+        return splat(0.5f) * select(first_half, splat(1.0f) - root, root + splat(1.0f));
+    }, t, result, count);
 }
-
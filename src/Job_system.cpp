@@ -0,0 +1,169 @@
+#include "Job_system.hpp"
+
+using namespace gf;
+
+namespace
+{
+    thread_local const Job_system* current_system = nullptr; ///< The job system the current thread works for
+    thread_local std::size_t current_queue = 0; ///< The queue owned by the current thread
+}
+
+Job_system::Job_system(std::size_t worker_count)
+{
+    for (std::size_t i = 0; i <= worker_count; ++i)
+    {
+        queues.push_back(std::make_unique<Queue>());
+    }
+
+    workers.reserve(worker_count);
+    for (std::size_t i = 0; i < worker_count; ++i)
+    {
+        workers.emplace_back(&Job_system::worker_loop, this, i);
+    }
+}
+
+Job_system::~Job_system()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        stopping = true;
+    }
+    wake_condition.notify_all();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+void Job_system::run(Job_counter& counter, Job job)
+{
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+    Queue& queue = *queues[get_queue_index()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back({std::move(job), &counter});
+    }
+    queued_jobs.fetch_add(1, std::memory_order_release);
+
+    // Taking the lock orders this notification after a sleeping worker has checked for jobs
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+    }
+    wake_condition.notify_one();
+}
+
+void Job_system::wait(Job_counter& counter)
+{
+    wait_for_all(counter);
+
+    if (counter.failed.load(std::memory_order_acquire))
+    {
+        counter.failed = false;
+        std::rethrow_exception(std::move(counter.exception));
+    }
+}
+
+std::size_t Job_system::get_worker_count() const
+{
+    return workers.size();
+}
+
+std::size_t Job_system::default_worker_count()
+{
+    unsigned int hardware_threads = std::thread::hardware_concurrency();
+    return (hardware_threads > 1) ? hardware_threads - 1 : 0;
+}
+
+void Job_system::worker_loop(std::size_t queue_index)
+{
+    current_system = this;
+    current_queue = queue_index;
+
+    while (!stopping.load(std::memory_order_acquire))
+    {
+        if (try_run_one(queue_index))
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        wake_condition.wait(lock, [this]()
+        {
+            return stopping.load(std::memory_order_acquire) || queued_jobs.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+bool Job_system::try_run_one(std::size_t queue_index)
+{
+    Job_entry entry;
+    if (try_pop(queue_index, entry) || try_steal(queue_index, entry))
+    {
+        execute(entry);
+        return true;
+    }
+    return false;
+}
+
+bool Job_system::try_pop(std::size_t queue_index, Job_entry& entry)
+{
+    Queue& queue = *queues[queue_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty())
+        return false;
+
+    entry = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool Job_system::try_steal(std::size_t thief_index, Job_entry& entry)
+{
+    for (std::size_t offset = 1; offset < queues.size(); ++offset)
+    {
+        Queue& queue = *queues[(thief_index + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty())
+            continue;
+
+        entry = std::move(queue.jobs.front());
+        queue.jobs.pop_front();
+        queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void Job_system::execute(Job_entry& entry)
+{
+    try
+    {
+        entry.job();
+    }
+    catch (...)
+    {
+        if (!entry.counter->failed.exchange(true, std::memory_order_acq_rel))
+        {
+            entry.counter->exception = std::current_exception();
+        }
+    }
+    entry.counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void Job_system::wait_for_all(Job_counter& counter)
+{
+    std::size_t queue_index = get_queue_index();
+    while (!counter.get_finished())
+    {
+        if (!try_run_one(queue_index))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+std::size_t Job_system::get_queue_index() const
+{
+    return (current_system == this) ? current_queue : workers.size();
+}
@@ -0,0 +1,109 @@
+#include "Path_follower_group.hpp"
+
+#include <cmath>
+#include "Profiler.hpp"
+
+using namespace gf;
+
+Path_follower_group::Path_follower_group(const Spline_path& path, bool loop, bool orient):
+    path{&path},
+    loop{loop},
+    orient{orient}
+{}
+
+void Path_follower_group::add(Game_object& object, float speed, float start_distance)
+{
+    objects.push_back(object.get_handle());
+    distances.push_back(start_distance);
+    speeds.push_back(speed);
+}
+
+void Path_follower_group::remove(const Game_object& object)
+{
+    Game_object_handle handle = object.get_handle();
+    for (std::size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i] == handle)
+        {
+            remove_at(i);
+            return;
+        }
+    }
+}
+
+void Path_follower_group::update(const Time& dt)
+{
+    GF_PROFILE_SCOPE("Path_follower_group::update");
+
+    // Drop followers of destroyed objects first, so the batch only evaluates live ones
+    for (std::size_t i = objects.size(); i-- > 0;)
+    {
+        if (!Game_object::resolve(objects[i]))
+            remove_at(i);
+    }
+
+    const std::size_t count = objects.size();
+    const float seconds = dt.get_seconds();
+    const float length = path->get_length();
+
+    if (loop && length > 0.0f)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float distance = std::fmod(distances[i] + speeds[i] * seconds, length);
+            distances[i] = (distance < 0.0f) ? distance + length : distance;
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            float distance = distances[i] + speeds[i] * seconds;
+            distances[i] = (distance < 0.0f) ? 0.0f : (distance < length) ? distance : length;
+        }
+    }
+
+    points.resize(count);
+    directions.resize(orient ? count : 0);
+    path->get_points_at_distances(distances.data(), points.data(), orient ? directions.data() : nullptr, count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Game_object* object = Game_object::resolve(objects[i]);
+        Transform2 transform = object->get_transform();
+        Angle rotation = orient ? directions[i].get_angle() : transform.rotation;
+
+        // Followers resting at an end of the path would otherwise dirty their subtree every frame
+        if (transform.position == points[i] && transform.rotation == rotation)
+            continue;
+
+        transform.position = points[i];
+        transform.set_rotation(rotation);
+        object->set_transform(transform);
+    }
+}
+
+std::size_t Path_follower_group::size() const
+{
+    return objects.size();
+}
+
+void Path_follower_group::clear()
+{
+    objects.clear();
+    distances.clear();
+    speeds.clear();
+    points.clear();
+    directions.clear();
+}
+
+void Path_follower_group::remove_at(std::size_t index)
+{
+    // Followers are unordered, so the last one fills the gap
+    objects[index] = objects.back();
+    distances[index] = distances.back();
+    speeds[index] = speeds.back();
+    objects.pop_back();
+    distances.pop_back();
+    speeds.pop_back();
+}
@@ -0,0 +1,202 @@
+#include "Position_solver_system.hpp"
+#include "Profiler.hpp"
+#include "Vector2_batch.hpp"
+
+#include <stdexcept>
+
+using namespace gf;
+
+Position_solver_system::Solver_handle Position_solver_system::move(Game_object& object, const Transform2& target, const Time& duration, Easing_type easing)
+{
+    stop(object);
+
+    const Transform2& current = object.get_transform();
+    float starts[] = {current.position.x, current.position.y, current.rotation.get_radians(), current.scale.x, current.scale.y};
+    float ends[] = {target.position.x, target.position.y, target.rotation.get_radians(), target.scale.x, target.scale.y};
+    wrap_shortest_path(starts[2], ends[2]);
+
+    Bucket& bucket = buckets[static_cast<std::size_t>(easing)];
+    auto row = static_cast<std::uint32_t>(bucket.objects.size());
+    Solver_handle solver = records.insert({easing, row});
+
+    bucket.elapsed.push_back(0.0f);
+    bucket.length.push_back(duration.get_milliseconds());
+    for (std::size_t c = 0; c < component_count; ++c)
+    {
+        bucket.start[c].push_back(starts[c]);
+        bucket.end[c].push_back(ends[c]);
+    }
+    bucket.objects.push_back(object.get_handle());
+    bucket.owners.push_back(solver);
+
+    solvers_by_object[object.get_handle().get_value()] = solver;
+    return solver;
+}
+
+void Position_solver_system::stop(Solver_handle solver)
+{
+    const Record* record = records.find(solver);
+    if (!record)
+        return;
+
+    remove_row(buckets[static_cast<std::size_t>(record->easing)], record->row);
+}
+
+void Position_solver_system::stop(const Game_object& object)
+{
+    auto found = solvers_by_object.find(object.get_handle().get_value());
+    if (found != solvers_by_object.end())
+        stop(found->second);
+}
+
+bool Position_solver_system::contains(Solver_handle solver) const
+{
+    return records.contains(solver);
+}
+
+float Position_solver_system::get_progress(Solver_handle solver) const
+{
+    const Record* record = records.find(solver);
+    if (!record)
+    {
+        throw std::out_of_range("Solver handle does not refer to a running move");
+    }
+
+    const Bucket& bucket = buckets[static_cast<std::size_t>(record->easing)];
+    float elapsed = bucket.elapsed[record->row];
+    float length = bucket.length[record->row];
+    return (elapsed >= length) ? 1.0f : elapsed / length;
+}
+
+void Position_solver_system::update(const Time& dt)
+{
+    GF_PROFILE_SCOPE("Position_solver_system::update");
+
+    const float step = dt.get_milliseconds();
+    for (std::size_t type = 0; type < buckets.size(); ++type)
+    {
+        Bucket& bucket = buckets[type];
+        const std::size_t count = bucket.objects.size();
+        if (count == 0)
+            continue;
+
+        progress.resize(count);
+        float* elapsed = bucket.elapsed.data();
+        const float* length = bucket.length.data();
+        float* t = progress.data();
+
+        // Branch free so that each loop vectorizes, a zero length divides to infinity in the lane that is not selected
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            elapsed[i] += step;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            t[i] = (elapsed[i] >= length[i]) ? 1.0f : elapsed[i] / length[i];
+        }
+
+        easing::evaluate(static_cast<Easing_type>(type), t, t, count);
+
+        // Finished rows land exactly on their end values, whatever the easing gives at 1
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            t[i] = (elapsed[i] >= length[i]) ? 1.0f : t[i];
+        }
+
+        for (std::size_t c = 0; c < component_count; ++c)
+        {
+            values[c].resize(count);
+            batch::lerp(bucket.start[c].data(), bucket.end[c].data(), t, values[c].data(), count);
+        }
+
+        // Scatter into the objects, skipping unchanged transforms so that they are not marked dirty
+        const float* x = values[0].data();
+        const float* y = values[1].data();
+        const float* rotation = values[2].data();
+        const float* scale_x = values[3].data();
+        const float* scale_y = values[4].data();
+        finished_rows.clear();
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Game_object* object = Game_object::resolve(bucket.objects[i]);
+            if (!object)
+            {
+                finished_rows.push_back(static_cast<std::uint32_t>(i));
+                continue;
+            }
+
+            const Transform2& current = object->get_transform();
+            if (current.position.x != x[i] || current.position.y != y[i] || current.rotation.get_radians() != rotation[i]
+                || current.scale.x != scale_x[i] || current.scale.y != scale_y[i])
+            {
+                object->set_transform(Transform2(x[i], y[i], Angle(rotation[i]), scale_x[i], scale_y[i]));
+            }
+
+            if (elapsed[i] >= length[i])
+                finished_rows.push_back(static_cast<std::uint32_t>(i));
+        }
+
+        // Removing from the back keeps the rows still to be removed in place
+        for (auto row = finished_rows.rbegin(); row != finished_rows.rend(); ++row)
+        {
+            remove_row(bucket, *row);
+        }
+    }
+}
+
+std::size_t Position_solver_system::size() const
+{
+    return solvers_by_object.size();
+}
+
+void Position_solver_system::clear()
+{
+    for (Bucket& bucket : buckets)
+    {
+        for (Solver_handle solver : bucket.owners)
+            records.erase(solver);
+
+        bucket.elapsed.clear();
+        bucket.length.clear();
+        for (std::size_t c = 0; c < component_count; ++c)
+        {
+            bucket.start[c].clear();
+            bucket.end[c].clear();
+        }
+        bucket.objects.clear();
+        bucket.owners.clear();
+    }
+    solvers_by_object.clear();
+}
+
+void Position_solver_system::remove_row(Bucket& bucket, std::size_t row)
+{
+    solvers_by_object.erase(bucket.objects[row].get_value());
+    records.erase(bucket.owners[row]);
+
+    // Rows are unordered, so the last one fills the gap
+    const std::size_t last = bucket.objects.size() - 1;
+    if (row != last)
+    {
+        bucket.elapsed[row] = bucket.elapsed[last];
+        bucket.length[row] = bucket.length[last];
+        for (std::size_t c = 0; c < component_count; ++c)
+        {
+            bucket.start[c][row] = bucket.start[c][last];
+            bucket.end[c][row] = bucket.end[c][last];
+        }
+        bucket.objects[row] = bucket.objects[last];
+        bucket.owners[row] = bucket.owners[last];
+        records.find(bucket.owners[row])->row = static_cast<std::uint32_t>(row);
+    }
+
+    bucket.elapsed.pop_back();
+    bucket.length.pop_back();
+    for (std::size_t c = 0; c < component_count; ++c)
+    {
+        bucket.start[c].pop_back();
+        bucket.end[c].pop_back();
+    }
+    bucket.objects.pop_back();
+    bucket.owners.pop_back();
+}
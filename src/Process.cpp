@@ -1,71 +1,87 @@
 #include "Process.hpp"
+#include "Easing_table.hpp"
 
 using namespace gf;
 
-Transform_linear_process::Transform_linear_process(const Transform2 &start, const Transform2 &end, const Time &length, const Easing_function &easing_function):
-    position{start.position, end.position, length, easing_function},
-    rotation{start.rotation, end.rotation, length, easing_function}
-{}
+Transform_linear_process::Transform_linear_process(const Transform2 &start, const Transform2 &end, const Time &length, Easing_type easing):
+    start_position{start.position},
+    end_position{end.position},
+    start_scale{start.scale},
+    end_scale{end.scale},
+    start_rotation{start.rotation.get_radians()},
+    end_rotation{end.rotation.get_radians()},
+    elapsed{0.0f},
+    length{length.get_milliseconds()},
+    easing_table{nullptr},
+    easing{easing}
+{
+    wrap_shortest_path(start_rotation, end_rotation);
+}
+
+Transform_linear_process::Transform_linear_process(const Transform2 &start, const Transform2 &end, const Time &length, const Easing_table& easing_table):
+    Transform_linear_process(start, end, length)
+{
+    this->easing_table = &easing_table;
+}
 
 void Transform_linear_process::reset_process()
 {
-    position.reset_process();
-    rotation.reset_process();
+    elapsed = 0.0f;
 }
 
 void Transform_linear_process::reset_process(const Time &new_length)
 {
-    position.reset_process(new_length);
-    rotation.reset_process(new_length);
+    length = new_length.get_milliseconds();
+    elapsed = 0.0f;
 }
 
 void Transform_linear_process::set_end(const Transform2 &new_end)
 {
-    position.set_end(new_end.position);
-    rotation.set_end(new_end.rotation);
+    end_position = new_end.position;
+    end_rotation = new_end.rotation.get_radians();
+    end_scale = new_end.scale;
+    wrap_shortest_path(start_rotation, end_rotation);
 }
 
 void Transform_linear_process::set_start(const Transform2 &new_start)
 {
-    position.set_start(new_start.position);
-    rotation.set_start(new_start.rotation);
+    start_position = new_start.position;
+    start_rotation = new_start.rotation.get_radians();
+    start_scale = new_start.scale;
+    wrap_shortest_path(start_rotation, end_rotation);
 }
 
 void Transform_linear_process::set_length(const Time &new_length)
 {
-    position.set_length(new_length);
-    rotation.set_length(new_length);
-}
-
-void Transform_linear_process::update(const Time &dt)
-{
-    position.update(dt);
-    rotation.update(dt);
+    length = new_length.get_milliseconds();
 }
 
 void Transform_linear_process::finish()
 {
-    position.finish();
-    rotation.finish();
-}
-
-bool Transform_linear_process::get_finished() const
-{
-    return position.get_finished() && rotation.get_finished();
+    if (elapsed < length)
+        elapsed = length;
 }
 
 Transform2 Transform_linear_process::get_start() const
 {
-    return {position.get_start(), rotation.get_start()};
+    return {start_position, Angle(start_rotation), start_scale};
 }
 
 Transform2 Transform_linear_process::get_end() const
 {
-    return {position.get_end(), rotation.get_end()};
+    return {end_position, Angle(end_rotation), end_scale};
 }
 
 Transform2 Transform_linear_process::get() const
 {
-    return {position.get(), rotation.get()};
-}
+    if (get_finished())
+        return get_end();
 
+    float progress = (elapsed > 0.0f) ? elapsed / length : 0.0f;
+    float t = easing_table ? (*easing_table)(progress) : easing::evaluate(easing, progress);
+    return {
+        start_position + (end_position - start_position) * t,
+        Angle(start_rotation + (end_rotation - start_rotation) * t),
+        start_scale + (end_scale - start_scale) * t
+    };
+}
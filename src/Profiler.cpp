@@ -0,0 +1,187 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace gf;
+
+namespace
+{
+    constexpr std::size_t buffer_capacity = 512; ///< Distinct names per thread, a power of two
+    const char* const overflow_name = "(profiler buffer full)";
+
+    /**
+     * @brief A slot of a thread buffer, written only by the owning thread and read by the collector
+    */
+    struct Slot
+    {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<std::uint64_t> calls{0};
+        std::atomic<std::uint64_t> nanoseconds{0};
+    };
+
+    struct Thread_buffer
+    {
+        Slot slots[buffer_capacity];
+        Slot overflow;
+    };
+
+    struct Registry
+    {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Thread_buffer>> buffers; ///< Kept after their threads exit so nothing is lost
+        std::unordered_map<std::string, profiling::Profile_entry> last_totals; ///< The totals at the end of the previous frame
+    };
+
+    Registry& get_registry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    thread_local Thread_buffer* local_buffer = nullptr;
+
+    Thread_buffer& get_local_buffer()
+    {
+        if (!local_buffer)
+        {
+            Registry& registry = get_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.buffers.push_back(std::make_unique<Thread_buffer>());
+            local_buffer = registry.buffers.back().get();
+        }
+        return *local_buffer;
+    }
+
+    void add(Slot& slot, std::uint64_t nanoseconds)
+    {
+        // Only the owning thread writes, so plain loads and stores are enough
+        slot.calls.store(slot.calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        slot.nanoseconds.store(slot.nanoseconds.load(std::memory_order_relaxed) + nanoseconds, std::memory_order_relaxed);
+    }
+
+    std::unordered_map<std::string, profiling::Profile_entry> aggregate(Registry& registry)
+    {
+        std::unordered_map<std::string, profiling::Profile_entry> totals;
+
+        auto collect = [&totals](const Slot& slot)
+        {
+            const char* name = slot.name.load(std::memory_order_acquire);
+            if (!name)
+                return;
+
+            // Names are merged by content, the same type name may live at several addresses
+            auto& entry = totals.try_emplace(name, profiling::Profile_entry{name, 0, 0}).first->second;
+            entry.calls += slot.calls.load(std::memory_order_relaxed);
+            entry.nanoseconds += slot.nanoseconds.load(std::memory_order_relaxed);
+        };
+
+        for (auto& buffer : registry.buffers)
+        {
+            for (const Slot& slot : buffer->slots)
+                collect(slot);
+            collect(buffer->overflow);
+        }
+        return totals;
+    }
+
+    std::vector<profiling::Profile_entry> sorted(std::vector<profiling::Profile_entry> entries)
+    {
+        std::sort(entries.begin(), entries.end(), [](const profiling::Profile_entry& a, const profiling::Profile_entry& b)
+        {
+            return a.nanoseconds > b.nanoseconds;
+        });
+        return entries;
+    }
+}
+
+void profiling::record(const char* name, std::uint64_t nanoseconds)
+{
+    Thread_buffer& buffer = get_local_buffer();
+
+    std::size_t index = (reinterpret_cast<std::uintptr_t>(name) >> 3) * 0x9E3779B97F4A7C15ull & (buffer_capacity - 1);
+    for (std::size_t probe = 0; probe < buffer_capacity; ++probe)
+    {
+        Slot& slot = buffer.slots[(index + probe) & (buffer_capacity - 1)];
+        const char* slot_name = slot.name.load(std::memory_order_relaxed);
+        if (slot_name == name)
+        {
+            add(slot, nanoseconds);
+            return;
+        }
+        if (!slot_name)
+        {
+            slot.name.store(name, std::memory_order_release);
+            add(slot, nanoseconds);
+            return;
+        }
+    }
+
+    buffer.overflow.name.store(overflow_name, std::memory_order_release);
+    add(buffer.overflow, nanoseconds);
+}
+
+std::vector<profiling::Profile_entry> profiling::end_frame()
+{
+    if (is_tracing())
+        trace_global_instant("Frame");
+
+    Registry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto totals = aggregate(registry);
+
+    std::vector<Profile_entry> frame;
+    for (auto& total : totals)
+    {
+        Profile_entry entry = total.second;
+        auto last = registry.last_totals.find(total.first);
+        if (last != registry.last_totals.end())
+        {
+            entry.calls -= last->second.calls;
+            entry.nanoseconds -= last->second.nanoseconds;
+        }
+
+        if (entry.calls > 0)
+            frame.push_back(entry);
+    }
+
+    registry.last_totals = std::move(totals);
+    return sorted(std::move(frame));
+}
+
+std::vector<profiling::Profile_entry> profiling::get_totals()
+{
+    Registry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    std::vector<Profile_entry> entries;
+    for (auto& total : aggregate(registry))
+        entries.push_back(total.second);
+    return sorted(std::move(entries));
+}
+
+void profiling::dump(std::ostream& os, const std::vector<Profile_entry>& entries)
+{
+    // The manipulators below are sticky, give the caller its stream back as it was
+    std::ios state(nullptr);
+    state.copyfmt(os);
+
+    os << std::left << std::setw(48) << "Name" << std::right << std::setw(12) << "Calls" << std::setw(16) << "Total (us)" << std::setw(14) << "Mean (ns)" << "\n";
+    for (const auto& entry : entries)
+    {
+        os << std::left << std::setw(48) << entry.name
+           << std::right << std::setw(12) << entry.calls
+           << std::setw(16) << std::fixed << std::setprecision(3) << entry.nanoseconds / 1000.0
+           << std::setw(14) << std::setprecision(1) << static_cast<double>(entry.nanoseconds) / static_cast<double>(entry.calls)
+           << "\n";
+    }
+
+    os.copyfmt(state);
+}
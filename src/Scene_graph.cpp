@@ -0,0 +1,271 @@
+#include "Scene_graph.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+using namespace gf;
+
+Scene_graph::Node_id Scene_graph::create_node(Node_id parent)
+{
+    std::uint32_t parent_row = (parent == null_node) ? null_row : row_of(parent);
+
+    Node_id node;
+    if (free_nodes.empty())
+    {
+        node = static_cast<Node_id>(node_rows.size());
+        node_rows.push_back(null_row);
+    }
+    else
+    {
+        node = free_nodes.back();
+        free_nodes.pop_back();
+    }
+
+    // Appending keeps the parent before the child, so creation never breaks the order
+    std::uint32_t row = static_cast<std::uint32_t>(row_nodes.size());
+    node_rows[node] = row;
+    local_transforms.emplace_back();
+    global_transforms.emplace_back();
+    previous_global_transforms.emplace_back();
+    child_anchors.emplace_back();
+    anchor_points.emplace_back();
+    parent_rows.push_back(parent_row);
+    dirty_rows.push_back(1);
+    row_nodes.push_back(node);
+
+    transforms_dirty = true;
+    return node;
+}
+
+void Scene_graph::destroy_node(Node_id node)
+{
+    std::uint32_t row = row_of(node);
+    row_nodes[row] = null_node;
+    node_rows[node] = null_row;
+    free_nodes.push_back(node);
+
+    // The row is dropped and its children are detached when the arrays are next linearized
+    ++dead_rows;
+    order_dirty = true;
+    transforms_dirty = true;
+}
+
+void Scene_graph::set_parent(Node_id node, Node_id parent)
+{
+    std::uint32_t row = row_of(node);
+    std::uint32_t parent_row = (parent == null_node) ? null_row : row_of(parent);
+
+    if (parent_row != null_row && (parent_row == row || is_descendant(parent_row, row)))
+    {
+        throw std::invalid_argument("A node cannot be parented to itself or one of its descendants");
+    }
+
+    parent_rows[row] = parent_row;
+    if (parent_row != null_row && parent_row > row)
+    {
+        order_dirty = true;
+    }
+    mark_dirty(node);
+}
+
+Scene_graph::Node_id Scene_graph::get_parent(Node_id node) const
+{
+    std::uint32_t parent_row = parent_rows[row_of(node)];
+    return (parent_row == null_row) ? null_node : row_nodes[parent_row];
+}
+
+const Transform2& Scene_graph::get_local_transform(Node_id node) const
+{
+    return local_transforms[row_of(node)];
+}
+
+void Scene_graph::set_local_transform(Node_id node, const Transform2& transform)
+{
+    local_transforms[row_of(node)] = transform;
+    mark_dirty(node);
+}
+
+const Vector2f& Scene_graph::get_anchor_point(Node_id node) const
+{
+    return anchor_points[row_of(node)];
+}
+
+void Scene_graph::set_anchor_point(Node_id node, const Vector2f& anchor_point)
+{
+    anchor_points[row_of(node)] = anchor_point;
+    mark_dirty(node);
+}
+
+const Transform2& Scene_graph::get_global_transform(Node_id node) const
+{
+    return global_transforms[row_of(node)];
+}
+
+const Transform2& Scene_graph::get_previous_global_transform(Node_id node) const
+{
+    return previous_global_transforms[row_of(node)];
+}
+
+void Scene_graph::store_previous_transforms()
+{
+    previous_global_transforms = global_transforms;
+}
+
+void Scene_graph::store_previous_transform(Node_id node)
+{
+    std::uint32_t row = row_of(node);
+    previous_global_transforms[row] = global_transforms[row];
+}
+
+void Scene_graph::mark_dirty(Node_id node)
+{
+    dirty_rows[row_of(node)] = 1;
+    transforms_dirty.store(true, std::memory_order_relaxed);
+}
+
+void Scene_graph::update_transforms()
+{
+    if (order_dirty)
+        linearize();
+
+    if (!transforms_dirty)
+        return;
+
+    const std::uint32_t row_count = static_cast<std::uint32_t>(row_nodes.size());
+    for (std::uint32_t row = 0; row < row_count; ++row)
+    {
+        std::uint32_t parent_row = parent_rows[row];
+        if (parent_row != null_row)
+            dirty_rows[row] |= dirty_rows[parent_row];
+
+        if (dirty_rows[row])
+            compute_row(row);
+    }
+
+    std::fill(dirty_rows.begin(), dirty_rows.end(), std::uint8_t{0});
+    transforms_dirty = false;
+}
+
+std::size_t Scene_graph::size() const
+{
+    return row_nodes.size() - dead_rows;
+}
+
+void Scene_graph::linearize()
+{
+    const std::uint32_t row_count = static_cast<std::uint32_t>(row_nodes.size());
+
+    // Build sibling lists that preserve the current relative order of the rows
+    std::vector<std::uint32_t> first_child(row_count, null_row);
+    std::vector<std::uint32_t> last_child(row_count, null_row);
+    std::vector<std::uint32_t> next_sibling(row_count, null_row);
+    std::vector<std::uint32_t> roots;
+
+    for (std::uint32_t row = 0; row < row_count; ++row)
+    {
+        if (row_nodes[row] == null_node)
+            continue;
+
+        std::uint32_t parent_row = parent_rows[row];
+        if (parent_row == null_row || row_nodes[parent_row] == null_node)
+        {
+            if (parent_row != null_row)
+                dirty_rows[row] = 1; // Detached from a destroyed parent
+            roots.push_back(row);
+        }
+        else if (first_child[parent_row] == null_row)
+        {
+            first_child[parent_row] = last_child[parent_row] = row;
+        }
+        else
+        {
+            next_sibling[last_child[parent_row]] = row;
+            last_child[parent_row] = row;
+        }
+    }
+
+    // Depth-first preorder, pushing siblings in reverse so they come out in order
+    std::vector<std::uint32_t> order;
+    order.reserve(row_count - dead_rows);
+    std::vector<std::uint32_t> stack;
+    std::vector<std::uint32_t> siblings;
+    for (auto root = roots.rbegin(); root != roots.rend(); ++root)
+        stack.push_back(*root);
+
+    while (!stack.empty())
+    {
+        std::uint32_t row = stack.back();
+        stack.pop_back();
+        order.push_back(row);
+
+        siblings.clear();
+        for (std::uint32_t child = first_child[row]; child != null_row; child = next_sibling[child])
+            siblings.push_back(child);
+        stack.insert(stack.end(), siblings.rbegin(), siblings.rend());
+    }
+
+    std::vector<std::uint32_t> new_rows(row_count, null_row);
+    for (std::uint32_t new_row = 0; new_row < order.size(); ++new_row)
+        new_rows[order[new_row]] = new_row;
+
+    auto gather = [&order](auto& column)
+    {
+        std::remove_reference_t<decltype(column)> sorted;
+        sorted.reserve(order.size());
+        for (std::uint32_t old_row : order)
+            sorted.push_back(column[old_row]);
+        column.swap(sorted);
+    };
+
+    gather(local_transforms);
+    gather(global_transforms);
+    gather(previous_global_transforms);
+    gather(child_anchors);
+    gather(anchor_points);
+    gather(dirty_rows);
+    gather(row_nodes);
+    gather(parent_rows);
+
+    for (std::uint32_t row = 0; row < order.size(); ++row)
+    {
+        std::uint32_t parent_row = parent_rows[row];
+        parent_rows[row] = (parent_row == null_row) ? null_row : new_rows[parent_row];
+        node_rows[row_nodes[row]] = row;
+    }
+
+    dead_rows = 0;
+    order_dirty = false;
+    transforms_dirty = true;
+}
+
+void Scene_graph::compute_row(std::uint32_t row)
+{
+    std::uint32_t parent_row = parent_rows[row];
+    const Transform2& local = local_transforms[row];
+
+    global_transforms[row] = (parent_row == null_row) ? local : child_anchors[parent_row] * local;
+
+    const Transform2& global = global_transforms[row];
+    child_anchors[row] = global + global.transform_vector(anchor_points[row]);
+}
+
+bool Scene_graph::is_descendant(std::uint32_t row, std::uint32_t ancestor_row) const
+{
+    for (std::uint32_t current = parent_rows[row]; current != null_row; current = parent_rows[current])
+    {
+        if (current == ancestor_row)
+            return true;
+    }
+    return false;
+}
+
+std::uint32_t Scene_graph::row_of(Node_id node) const
+{
+    std::uint32_t row = node_rows.at(node);
+    if (row == null_row)
+    {
+        throw std::out_of_range("Scene graph node has been destroyed");
+    }
+    return row;
+}
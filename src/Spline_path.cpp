@@ -0,0 +1,194 @@
+#include "Spline_path.hpp"
+
+#include <stdexcept>
+
+using namespace gf;
+
+Spline_path::Spline_path(Spline_type type, const std::vector<Vector2f>& control_points, std::size_t samples_per_segment)
+{
+    const std::size_t count = control_points.size();
+    const std::vector<Vector2f>& p = control_points;
+
+    switch (type)
+    {
+        case Spline_type::catmull_rom:
+        {
+            if (count < 2)
+            {
+                throw std::invalid_argument("A Catmull-Rom path needs at least 2 control points");
+            }
+
+            // The ends are extended by mirroring their neighbours, so the path passes through every point
+            auto point = [&p, count](std::ptrdiff_t i) -> Vector2f
+            {
+                if (i < 0)
+                    return p[0] * 2.0f - p[1];
+                if (i >= static_cast<std::ptrdiff_t>(count))
+                    return p[count - 1] * 2.0f - p[count - 2];
+                return p[static_cast<std::size_t>(i)];
+            };
+
+            for (std::ptrdiff_t i = 0; i + 1 < static_cast<std::ptrdiff_t>(count); ++i)
+            {
+                Vector2f p0 = point(i - 1), p1 = point(i), p2 = point(i + 1), p3 = point(i + 2);
+                segments.push_back({
+                    p1,
+                    (p2 - p0) * 0.5f,
+                    (p0 * 2.0f - p1 * 5.0f + p2 * 4.0f - p3) * 0.5f,
+                    (p1 * 3.0f - p0 - p2 * 3.0f + p3) * 0.5f
+                });
+            }
+            break;
+        }
+
+        case Spline_type::cubic_bezier:
+        {
+            if (count < 4 || (count - 1) % 3 != 0)
+            {
+                throw std::invalid_argument("A cubic Bezier path needs 3n + 1 control points, with n at least 1");
+            }
+
+            for (std::size_t i = 0; i + 3 < count; i += 3)
+            {
+                segments.push_back({
+                    p[i],
+                    (p[i + 1] - p[i]) * 3.0f,
+                    (p[i] - p[i + 1] * 2.0f + p[i + 2]) * 3.0f,
+                    p[i + 1] * 3.0f - p[i] - p[i + 2] * 3.0f + p[i + 3]
+                });
+            }
+            break;
+        }
+
+        case Spline_type::b_spline:
+        {
+            if (count < 4)
+            {
+                throw std::invalid_argument("A B-spline path needs at least 4 control points");
+            }
+
+            for (std::size_t i = 0; i + 3 < count; ++i)
+            {
+                segments.push_back({
+                    (p[i] + p[i + 1] * 4.0f + p[i + 2]) * (1.0f / 6.0f),
+                    (p[i + 2] - p[i]) * 0.5f,
+                    (p[i] - p[i + 1] * 2.0f + p[i + 2]) * 0.5f,
+                    (p[i + 1] * 3.0f - p[i] - p[i + 2] * 3.0f + p[i + 3]) * (1.0f / 6.0f)
+                });
+            }
+            break;
+        }
+    }
+
+    build_arc_length_table(samples_per_segment < 1 ? 1 : samples_per_segment);
+}
+
+std::size_t Spline_path::get_segment_count() const
+{
+    return segments.size();
+}
+
+float Spline_path::get_length() const
+{
+    return length;
+}
+
+Vector2f Spline_path::get_point(float u) const
+{
+    float s;
+    const Segment& segment = locate(u, s);
+    return segment.a + (segment.b + (segment.c + segment.d * s) * s) * s;
+}
+
+Vector2f Spline_path::get_tangent(float u) const
+{
+    float s;
+    const Segment& segment = locate(u, s);
+    return segment.b + (segment.c * 2.0f + segment.d * (3.0f * s)) * s;
+}
+
+float Spline_path::get_parameter_at_distance(float distance) const
+{
+    const float last = static_cast<float>(parameters_by_distance.size() - 2);
+    float x = distance * table_scale;
+    x = (x > 0.0f) ? ((x < last) ? x : last) : 0.0f;
+    auto index = static_cast<std::int32_t>(x);
+    float fraction = x - static_cast<float>(index);
+    return parameters_by_distance[index] + (parameters_by_distance[index + 1] - parameters_by_distance[index]) * fraction;
+}
+
+Vector2f Spline_path::get_point_at_distance(float distance) const
+{
+    return get_point(get_parameter_at_distance(distance));
+}
+
+Vector2f Spline_path::get_direction_at_distance(float distance) const
+{
+    Vector2f tangent = get_tangent(get_parameter_at_distance(distance));
+    float tangent_length = tangent.get_length();
+    return (tangent_length > 0.0f) ? tangent * (1.0f / tangent_length) : Vector2f();
+}
+
+void Spline_path::get_points_at_distances(const float* distances, Vector2f* points, Vector2f* directions, std::size_t count) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        float s;
+        const Segment& segment = locate(get_parameter_at_distance(distances[i]), s);
+        points[i] = segment.a + (segment.b + (segment.c + segment.d * s) * s) * s;
+
+        if (directions)
+        {
+            Vector2f tangent = segment.b + (segment.c * 2.0f + segment.d * (3.0f * s)) * s;
+            float tangent_length = tangent.get_length();
+            directions[i] = (tangent_length > 0.0f) ? tangent * (1.0f / tangent_length) : Vector2f();
+        }
+    }
+}
+
+const Spline_path::Segment& Spline_path::locate(float u, float& s) const
+{
+    const float segment_count = static_cast<float>(segments.size());
+    u = (u > 0.0f) ? ((u < segment_count) ? u : segment_count) : 0.0f;
+
+    auto index = static_cast<std::size_t>(static_cast<std::int32_t>(u));
+    if (index >= segments.size())
+        index = segments.size() - 1;
+
+    s = u - static_cast<float>(index);
+    return segments[index];
+}
+
+void Spline_path::build_arc_length_table(std::size_t samples_per_segment)
+{
+    const std::size_t sample_count = segments.size() * samples_per_segment;
+    const float step = 1.0f / static_cast<float>(samples_per_segment);
+
+    // Chord lengths between dense samples approximate the length by parameter
+    std::vector<float> lengths(sample_count + 1, 0.0f);
+    Vector2f previous = get_point(0.0f);
+    for (std::size_t i = 1; i <= sample_count; ++i)
+    {
+        Vector2f point = get_point(static_cast<float>(i) * step);
+        lengths[i] = lengths[i - 1] + (point - previous).get_length();
+        previous = point;
+    }
+    length = lengths.back();
+
+    // Invert it into the parameter at evenly spaced distances, with the last entry repeated for branch free lookups
+    parameters_by_distance.assign(sample_count + 2, static_cast<float>(segments.size()));
+    parameters_by_distance[0] = 0.0f;
+    std::size_t k = 0;
+    for (std::size_t j = 1; j < sample_count; ++j)
+    {
+        float target = length * static_cast<float>(j) / static_cast<float>(sample_count);
+        while (k + 1 < sample_count && lengths[k + 1] < target)
+            ++k;
+
+        float interval = lengths[k + 1] - lengths[k];
+        float fraction = (interval > 0.0f) ? (target - lengths[k]) / interval : 0.0f;
+        parameters_by_distance[j] = (static_cast<float>(k) + fraction) * step;
+    }
+
+    table_scale = (length > 0.0f) ? static_cast<float>(sample_count) / length : 0.0f;
+}
@@ -1,4 +1,5 @@
 #include "State_machine.hpp"
+#include "Profiler.hpp"
 
 using namespace gf;
 
@@ -16,6 +17,7 @@ void State_machine::push_state(State* state)
 
 void State_machine::update()
 {   
+    GF_PROFILE_SCOPE("State_machine::update");
     if (current_state == nullptr)
         return;
 
@@ -31,6 +33,8 @@ void State_machine::update()
     current_state->update();
     if (current_state->next_state_id != -1)
     {
+        GF_TRACE_INSTANT("State_machine::transition", "to", current_state->next_state_id);
+        GF_PROFILE_SCOPE("State_machine::transition");
         current_state->on_exit();
         int temp = current_state->next_state_id;
         current_state->next_state_id = -1;
@@ -41,6 +45,8 @@ void State_machine::update()
 
 void State_machine::set_state(int state_id)
 {
+    GF_TRACE_INSTANT("State_machine::transition", "to", state_id);
+    GF_PROFILE_SCOPE("State_machine::transition");
     if (current_state != nullptr)
         current_state->on_exit();
     current_state = states[state_id];
@@ -52,9 +58,9 @@ int State_machine::get_current_state_id()
     return current_state->id;
 }
 
-void State_machine::add_trigger(int state_id, std::function<bool()> trigger)
+void State_machine::add_trigger(int state_id, Inplace_function<bool()> trigger)
 {
-    triggers.push_back({state_id, trigger});
+    triggers.push_back({state_id, std::move(trigger)});
 }
 
 bool gf::State_machine::is_blocked(int trigger_id)
@@ -0,0 +1,413 @@
+#include "Timer_service.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include "Profiler.hpp"
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+using namespace gf;
+
+namespace
+{
+    constexpr std::uint16_t firing_slot = 0xFFFE; ///< Taken out of its slot to be called by the current tick
+    constexpr std::uint64_t slot_mask = Timer_service::slot_count - 1;
+    constexpr std::uint64_t max_delta = (std::uint64_t{1} << (Timer_service::slot_bits * Timer_service::level_count)) - 1;
+
+    /**
+     * @brief Get whether tick a is before tick b, ticks are compared by difference so that they can wrap
+    */
+    bool is_before(std::uint64_t a, std::uint64_t b)
+    {
+        return static_cast<std::int64_t>(a - b) < 0;
+    }
+
+    unsigned count_trailing_zeros(std::uint64_t word)
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(word));
+        #elif defined(_MSC_VER) && defined(_M_X64)
+            unsigned long index;
+            _BitScanForward64(&index, word);
+            return static_cast<unsigned>(index);
+        #else
+            unsigned index = 0;
+            while (!(word & 1))
+            {
+                word >>= 1;
+                ++index;
+            }
+            return index;
+        #endif
+    }
+} // namespace
+
+Timer_service::Timer_service(const Time& resolution):
+    occupied{},
+    resolution{resolution.get_milliseconds()}
+{
+    if (!(this->resolution > 0.0f))
+    {
+        throw std::invalid_argument("A timer service needs a positive resolution");
+    }
+}
+
+Timer_service::Timer_handle Timer_service::schedule(const Time& delay, const Inplace_function<void()>& callback)
+{
+    return create(delay, 0, false, callback);
+}
+
+Timer_service::Timer_handle Timer_service::schedule_repeating(const Time& period, const Inplace_function<void()>& callback)
+{
+    return create(period, std::max<std::uint64_t>(to_ticks(period), 1), false, callback);
+}
+
+void Timer_service::cancel(Timer_handle timer)
+{
+    Timer_record* record = timers.find(timer);
+    if (!record)
+        return;
+
+    unlink(*record);
+    timers.erase(timer);
+    --timer_count;
+}
+
+bool Timer_service::contains(Timer_handle timer) const
+{
+    return timers.contains(timer);
+}
+
+Time Timer_service::get_remaining_time(Timer_handle timer) const
+{
+    const Timer_record* record = timers.find(timer);
+    if (!record)
+    {
+        throw std::out_of_range("Timer handle does not refer to a live timer");
+    }
+
+    if (!is_before(current, record->deadline))
+        return Time();
+    return Time(static_cast<float>(record->deadline - current) * resolution);
+}
+
+void Timer_service::tick(const Time& delta_time)
+{
+    GF_PROFILE_SCOPE("Timer_service::tick");
+
+    accumulated = std::max(accumulated + delta_time.get_milliseconds(), 0.0f);
+    auto ticks = static_cast<std::uint64_t>(accumulated / resolution);
+    if (ticks == 0)
+        return;
+
+    accumulated = std::max(accumulated - static_cast<float>(ticks) * resolution, 0.0f);
+    advance_to(current + ticks);
+}
+
+Time Timer_service::get_time() const
+{
+    return Time(static_cast<float>(current) * resolution);
+}
+
+Time Timer_service::get_resolution() const
+{
+    return Time(resolution);
+}
+
+std::size_t Timer_service::size() const
+{
+    return timer_count;
+}
+
+Timer_service::Timer_handle Timer_service::create(const Time& length, std::uint64_t period, bool owned, const Inplace_function<void()>& callback)
+{
+    std::uint64_t deadline = current + (period ? period : to_ticks(length));
+    Timer_handle timer = timers.insert({callback, length, current, deadline, period, {}, {}, no_slot, owned});
+    ++timer_count;
+    start(timer, *timers.find(timer));
+    return timer;
+}
+
+void Timer_service::start(Timer_handle timer, Timer_record& record)
+{
+    unlink(record);
+    // The current tick has already been processed, so the earliest a timer can fire is the next one
+    std::uint64_t earliest = current + 1;
+    link(timer, record, is_before(record.deadline, earliest) ? earliest : record.deadline);
+}
+
+std::uint64_t Timer_service::to_ticks(const Time& time) const
+{
+    double ticks = static_cast<double>(time.get_milliseconds()) / static_cast<double>(resolution);
+    // The tolerance keeps lengths that are whole multiples of the resolution from rounding up a tick
+    return (ticks > 0.0) ? static_cast<std::uint64_t>(std::ceil(ticks - 1e-6)) : 0;
+}
+
+void Timer_service::link(Timer_handle timer, Timer_record& record, std::uint64_t due)
+{
+    // Timers beyond the last wheel wait in its farthest slot and are placed again when it comes around
+    std::uint64_t delta = due - current;
+    if (delta > max_delta)
+    {
+        delta = max_delta;
+        due = current + max_delta;
+    }
+
+    std::size_t level = 0;
+    while (level + 1 < level_count && delta >= (std::uint64_t{1} << (slot_bits * (level + 1))))
+        ++level;
+
+    std::size_t index = static_cast<std::size_t>((due >> (slot_bits * level)) & slot_mask);
+    std::size_t slot = level * slot_count + index;
+
+    record.previous = Timer_handle();
+    record.next = slots[slot];
+    if (!record.next.is_null())
+        timers.find(record.next)->previous = timer;
+    slots[slot] = timer;
+    record.slot = static_cast<std::uint16_t>(slot);
+
+    if (level == 0)
+        occupied[index / 64] |= std::uint64_t{1} << (index % 64);
+}
+
+void Timer_service::unlink(Timer_record& record)
+{
+    if (record.slot == no_slot || record.slot == firing_slot)
+    {
+        record.slot = no_slot;
+        return;
+    }
+
+    if (!record.next.is_null())
+        timers.find(record.next)->previous = record.previous;
+
+    if (!record.previous.is_null())
+    {
+        timers.find(record.previous)->next = record.next;
+    }
+    else
+    {
+        slots[record.slot] = record.next;
+        if (record.slot < slot_count && record.next.is_null())
+            occupied[record.slot / 64] &= ~(std::uint64_t{1} << (record.slot % 64));
+    }
+
+    record.slot = no_slot;
+}
+
+void Timer_service::cascade(std::size_t level)
+{
+    std::size_t slot = level * slot_count + static_cast<std::size_t>((current >> (slot_bits * level)) & slot_mask);
+    Timer_handle timer = slots[slot];
+    slots[slot] = Timer_handle();
+
+    while (!timer.is_null())
+    {
+        Timer_record& record = *timers.find(timer);
+        Timer_handle next = record.next;
+        // Linking never inserts into the table, so the reference stays valid
+        link(timer, record, is_before(record.deadline, current) ? current : record.deadline);
+        timer = next;
+    }
+}
+
+void Timer_service::fire_slot(std::size_t index)
+{
+    Timer_handle timer = slots[index];
+    if (timer.is_null())
+        return;
+
+    slots[index] = Timer_handle();
+    occupied[index / 64] &= ~(std::uint64_t{1} << (index % 64));
+
+    // Callbacks may schedule and cancel timers, so the due ones are taken out of the wheel first
+    firing.clear();
+    while (!timer.is_null())
+    {
+        Timer_record& record = *timers.find(timer);
+        record.slot = firing_slot;
+        firing.push_back(timer);
+        timer = record.next;
+    }
+
+    for (Timer_handle due : firing)
+    {
+        Timer_record* record = timers.find(due);
+        if (!record || record->slot != firing_slot)
+            continue;
+        record->slot = no_slot;
+
+        Inplace_function<void()> callback = std::move(record->callback);
+        if (!record->owned && !record->period)
+        {
+            timers.erase(due);
+            --timer_count;
+        }
+        else if (record->period)
+        {
+            record->start = current;
+            record->deadline = current + record->period;
+            start(due, *record);
+        }
+
+        if (callback)
+        {
+            GF_PROFILE_SCOPE("Timer_service::callback");
+            callback();
+        }
+
+        // The record may have moved or gone while the callback ran
+        record = timers.find(due);
+        if (record && !record->callback)
+            record->callback = std::move(callback);
+    }
+}
+
+void Timer_service::advance_to(std::uint64_t target)
+{
+    while (current != target)
+    {
+        // Jump to the next occupied slot of the first wheel, stopping at the end of its turn to move timers down
+        std::uint64_t turn_end = (current | slot_mask) + 1;
+        std::uint64_t next = is_before(target, turn_end) ? target : turn_end;
+
+        std::size_t position = static_cast<std::size_t>(current & slot_mask) + 1;
+        for (std::size_t word = position / 64; word < occupied.size(); ++word)
+        {
+            std::uint64_t bits = occupied[word];
+            if (word == position / 64)
+                bits &= ~std::uint64_t{0} << (position % 64);
+            if (bits)
+            {
+                std::uint64_t occupied_tick = (current & ~slot_mask) + word * 64 + count_trailing_zeros(bits);
+                if (is_before(occupied_tick, next))
+                    next = occupied_tick;
+                break;
+            }
+        }
+
+        current = next;
+
+        if ((current & slot_mask) == 0)
+        {
+            std::size_t top = 1;
+            while (top + 1 < level_count && ((current >> (slot_bits * top)) & slot_mask) == 0)
+                ++top;
+            for (std::size_t level = top; level > 0; --level)
+                cascade(level);
+        }
+
+        fire_slot(static_cast<std::size_t>(current & slot_mask));
+    }
+}
+
+Timer::Timer(Timer_service& service, const Time& length):
+    Timer(service, length, Inplace_function<void()>{})
+{}
+
+Timer::Timer(Timer_service& service, const Time& length, const Inplace_function<void()>& new_callback):
+    service{&service},
+    handle{service.create(length, 0, true, new_callback)}
+{}
+
+Timer::Timer(Timer_service& service, const Time& length, const Time& elapsed, const Inplace_function<void()>& new_callback):
+    Timer(service, length, new_callback)
+{
+    Timer_service::Timer_record& record = get_record();
+    record.start = service.current - service.to_ticks(elapsed);
+    record.deadline = record.start + service.to_ticks(length);
+    service.start(handle, record);
+}
+
+Timer::Timer(Timer&& other) noexcept:
+    service{other.service},
+    handle{other.handle}
+{
+    other.service = nullptr;
+}
+
+Timer& Timer::operator=(Timer&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (service)
+            service->cancel(handle);
+        service = other.service;
+        handle = other.handle;
+        other.service = nullptr;
+    }
+    return *this;
+}
+
+Timer::~Timer()
+{
+    if (service)
+        service->cancel(handle);
+}
+
+void Timer::restart()
+{
+    Timer_service::Timer_record& record = get_record();
+    record.start = service->current;
+    record.deadline = record.start + service->to_ticks(record.length);
+    service->start(handle, record);
+}
+
+void Timer::reset(const Time& length)
+{
+    get_record().length = length;
+    restart();
+}
+
+void Timer::set_length(const Time& new_length)
+{
+    Timer_service::Timer_record& record = get_record();
+    record.length = new_length;
+    record.deadline = record.start + service->to_ticks(new_length);
+
+    // A finished timer that has already fired stays out of the wheel
+    if (record.slot != Timer_service::no_slot || is_before(service->current, record.deadline))
+        service->start(handle, record);
+}
+
+Time Timer::get_length() const
+{
+    return get_record().length;
+}
+
+float Timer::get_normalized_progress() const
+{
+    Time elapsed = get_elapsed_time();
+    Time length = get_length();
+    return (elapsed > length) ? 1.0f : elapsed / length;
+}
+
+Time Timer::get_elapsed_time() const
+{
+    return Time(static_cast<float>(service->current - get_record().start) * service->resolution);
+}
+
+Time Timer::get_remaining_time() const
+{
+    return get_length() - get_elapsed_time();
+}
+
+bool Timer::get_finished() const
+{
+    return !is_before(service->current, get_record().deadline);
+}
+
+void Timer::add_callback(const Inplace_function<void()>& new_callback)
+{
+    get_record().callback = new_callback;
+}
+
+Timer_service::Timer_record& Timer::get_record() const
+{
+    return *service->timers.find(handle);
+}
@@ -0,0 +1,251 @@
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+using namespace gf;
+
+std::atomic<bool> profiling::detail::tracing{false};
+
+namespace
+{
+    using Clock_type = std::chrono::steady_clock;
+
+    struct Trace_event
+    {
+        const char* name;
+        Clock_type::time_point start;
+        Clock_type::duration duration;
+        const char* arg_name;
+        std::int64_t arg_value;
+        char phase; ///< 'X' for a span, 'i' for an instant
+        char scope; ///< 't' for the thread, 'g' for every thread
+    };
+
+    /**
+     * @brief The events of one thread, guarded by its own mutex so that writing them out is only contended while stopping
+    */
+    struct Thread_trace
+    {
+        std::mutex mutex;
+        std::vector<Trace_event> events;
+        std::uint32_t id;
+        bool named = false;
+    };
+
+    /**
+     * @brief The running trace, a thread's mutex is always taken before this one
+    */
+    struct Session
+    {
+        std::mutex mutex;
+        std::ofstream file;
+        bool first_event = true;
+        Clock_type::time_point origin;
+        std::atomic<std::size_t> events_per_thread{1};
+        std::vector<std::unique_ptr<Thread_trace>> threads; ///< Kept after their threads exit so their events are not lost
+    };
+
+    Session& get_session()
+    {
+        static Session session;
+        return session;
+    }
+
+    thread_local Thread_trace* local_trace = nullptr;
+
+    Thread_trace& get_local_trace()
+    {
+        if (!local_trace)
+        {
+            Session& session = get_session();
+            std::lock_guard<std::mutex> lock(session.mutex);
+            session.threads.push_back(std::make_unique<Thread_trace>());
+            local_trace = session.threads.back().get();
+            local_trace->id = static_cast<std::uint32_t>(session.threads.size());
+        }
+        return *local_trace;
+    }
+
+    void write_string(std::ofstream& file, const char* string)
+    {
+        file << '"';
+        for (const char* c = string; *c; ++c)
+        {
+            if (*c == '"' || *c == '\\')
+            {
+                file << '\\' << *c;
+            }
+            else if (static_cast<unsigned char>(*c) < 0x20)
+            {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(*c));
+                file << escaped;
+            }
+            else
+            {
+                file << *c;
+            }
+        }
+        file << '"';
+    }
+
+    double to_microseconds(Clock_type::duration duration)
+    {
+        return std::chrono::duration<double, std::micro>(duration).count();
+    }
+
+    /**
+     * @brief Append a thread's events to the file, must be called with both the thread's and the session's mutex held
+    */
+    void write_events(Session& session, Thread_trace& thread)
+    {
+        if (!session.file.is_open() || thread.events.empty())
+        {
+            thread.events.clear();
+            return;
+        }
+
+        std::ofstream& file = session.file;
+        auto separate = [&session, &file]()
+        {
+            file << (session.first_event ? "\n" : ",\n");
+            session.first_event = false;
+        };
+
+        if (!thread.named)
+        {
+            separate();
+            file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread.id
+                 << ",\"args\":{\"name\":\"Thread " << thread.id << "\"}}";
+            thread.named = true;
+        }
+
+        for (const Trace_event& event : thread.events)
+        {
+            // Scopes opened before the trace started are clipped to its start
+            Clock_type::time_point start = std::max(event.start, session.origin);
+            Clock_type::duration duration = std::max(event.start + event.duration - start, Clock_type::duration::zero());
+
+            separate();
+            file << "{\"name\":";
+            write_string(file, event.name);
+            file << ",\"ph\":\"" << event.phase << "\",\"pid\":1,\"tid\":" << thread.id
+                 << ",\"ts\":" << to_microseconds(start - session.origin);
+
+            if (event.phase == 'X')
+                file << ",\"dur\":" << to_microseconds(duration);
+            else
+                file << ",\"s\":\"" << event.scope << "\"";
+
+            if (event.arg_name)
+            {
+                file << ",\"args\":{";
+                write_string(file, event.arg_name);
+                file << ':' << event.arg_value << '}';
+            }
+            file << '}';
+        }
+        thread.events.clear();
+    }
+
+    void add_event(const Trace_event& event)
+    {
+        Thread_trace& thread = get_local_trace();
+        std::lock_guard<std::mutex> lock(thread.mutex);
+
+        thread.events.push_back(event);
+        Session& session = get_session();
+        if (thread.events.size() >= session.events_per_thread.load(std::memory_order_relaxed))
+        {
+            std::lock_guard<std::mutex> session_lock(session.mutex);
+            write_events(session, thread);
+        }
+    }
+}
+
+void profiling::start_trace(const std::string& path, std::size_t events_per_thread)
+{
+    Session& session = get_session();
+    std::vector<Thread_trace*> threads;
+    {
+        std::lock_guard<std::mutex> lock(session.mutex);
+        if (session.file.is_open())
+        {
+            throw std::runtime_error("A trace is already running");
+        }
+
+        session.file.open(path, std::ios::out | std::ios::trunc);
+        if (!session.file)
+        {
+            session.file = std::ofstream();
+            throw std::runtime_error("Could not open trace file " + path);
+        }
+
+        session.file << std::fixed << std::setprecision(3);
+        session.file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        session.first_event = true;
+        session.origin = Clock_type::now();
+        session.events_per_thread.store(std::max<std::size_t>(events_per_thread, 1), std::memory_order_relaxed);
+
+        for (auto& thread : session.threads)
+            threads.push_back(thread.get());
+    }
+
+    // Events that raced with the end of a previous trace are dropped
+    for (Thread_trace* thread : threads)
+    {
+        std::lock_guard<std::mutex> lock(thread->mutex);
+        thread->events.clear();
+        thread->events.reserve(session.events_per_thread.load(std::memory_order_relaxed));
+        thread->named = false;
+    }
+
+    detail::tracing.store(true, std::memory_order_release);
+}
+
+void profiling::stop_trace()
+{
+    if (!detail::tracing.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    Session& session = get_session();
+    std::vector<Thread_trace*> threads;
+    {
+        std::lock_guard<std::mutex> lock(session.mutex);
+        for (auto& thread : session.threads)
+            threads.push_back(thread.get());
+    }
+
+    for (Thread_trace* thread : threads)
+    {
+        std::lock_guard<std::mutex> lock(thread->mutex);
+        std::lock_guard<std::mutex> session_lock(session.mutex);
+        write_events(session, *thread);
+    }
+
+    std::lock_guard<std::mutex> lock(session.mutex);
+    session.file << "\n]}\n";
+    session.file.close();
+}
+
+void profiling::trace_complete(const char* name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    add_event({name, start, end - start, nullptr, 0, 'X', 't'});
+}
+
+void profiling::trace_instant(const char* name, const char* arg_name, std::int64_t arg_value)
+{
+    add_event({name, Clock_type::now(), Clock_type::duration::zero(), arg_name, arg_value, 'i', 't'});
+}
+
+void profiling::trace_global_instant(const char* name)
+{
+    add_event({name, Clock_type::now(), Clock_type::duration::zero(), nullptr, 0, 'i', 'g'});
+}
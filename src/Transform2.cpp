@@ -1,4 +1,7 @@
 #include "Transform2.hpp"
+#include "Vector2_batch.hpp"
+
+#include <cmath>
 
 using namespace gf; 
 
@@ -23,6 +26,16 @@ std::string Transform2::get_string() const
     return "Transform(Position: " + position.get_string() + ", Rotation: " + rotation.get_string() + ", Scale: " + scale.get_string() + ")";
 }
 
+Matrix2x3 Transform2::get_matrix() const
+{
+    Sin_cos sin_cos = get_basis();
+    return Matrix2x3{
+        Vector2f(sin_cos.cos * scale.x, sin_cos.sin * scale.x),
+        Vector2f(-sin_cos.sin * scale.y, sin_cos.cos * scale.y),
+        position
+    };
+}
+
 void Transform2::set_position(const Vector2f &position)
 {
     this->position = position;
@@ -31,6 +44,7 @@ void Transform2::set_position(const Vector2f &position)
 void Transform2::set_rotation(const Angle &rotation)
 {
     this->rotation = rotation;
+    refresh_basis();
 }
 
 void Transform2::set_scale(const Vector2f &scale)
@@ -40,18 +54,20 @@ void Transform2::set_scale(const Vector2f &scale)
 
 Transform2 Transform2::operator*(const Transform2 &other) const
 {
+    // The basis of the sum of the rotations follows from the angle addition formulas
+    Sin_cos a = get_basis();
+    Sin_cos b = other.get_basis();
     return Transform2(
-        position + other.position,
+        transform_point(other.position),
         rotation + other.rotation,
-        scale * other.scale
+        scale * other.scale,
+        Sin_cos{a.sin * b.cos + a.cos * b.sin, a.cos * b.cos - a.sin * b.sin}
     );
 }
 
 Transform2& Transform2::operator*= (const Transform2 &other)
 {
-    position += other.position;
-    rotation += other.rotation;
-    scale *= other.scale;
+    *this = *this * other;
     return *this;
 }
 
@@ -63,12 +79,13 @@ Transform2 Transform2::operator+(const Angle &angle) const
 Transform2 &Transform2::operator+=(const Angle &angle)
 {
     rotation += angle;
+    refresh_basis();
     return *this;
 }
 
 Transform2 Transform2::operator+(const Vector2f &vector) const
 {
-    return Transform2(position + vector, rotation, scale);
+    return Transform2(position + vector, rotation, scale, get_basis());
 }
 
 Transform2 &Transform2::operator+=(const Vector2f &vector)
@@ -85,12 +102,13 @@ Transform2 Transform2::operator-(const Angle &angle) const
 Transform2 &Transform2::operator-=(const Angle &angle)
 {
     rotation -= angle;
+    refresh_basis();
     return *this;
 }
 
 Transform2 Transform2::operator-(const Vector2f &vector) const
 {
-    return Transform2(position - vector, rotation, scale);
+    return Transform2(position - vector, rotation, scale, get_basis());
 }
 
 Transform2 &Transform2::operator-=(const Vector2f &vector)
@@ -109,6 +127,29 @@ bool Transform2::operator!=(const Transform2 &other) const
     return !(*this == other);
 }
 
+Vector2f Transform2::transform_point(const Vector2f &point) const
+{
+    return position + transform_vector(point);
+}
+
+Vector2f Transform2::transform_vector(const Vector2f &vector) const
+{
+    Sin_cos sin_cos = get_basis();
+    float x = vector.x * scale.x;
+    float y = vector.y * scale.y;
+    return Vector2f(x * sin_cos.cos - y * sin_cos.sin, x * sin_cos.sin + y * sin_cos.cos);
+}
+
+void Transform2::transform_points(const Vector2f *points, Vector2f *result, std::size_t count) const
+{
+    batch::transform(points, result, count, get_matrix());
+}
+
+void Transform2::transform_points(const float *x, const float *y, float *result_x, float *result_y, std::size_t count) const
+{
+    batch::transform(x, y, result_x, result_y, count, get_matrix());
+}
+
 void Transform2::translate(const Vector2f &offset)
 {
     position += offset;
@@ -117,6 +158,7 @@ void Transform2::translate(const Vector2f &offset)
 void Transform2::rotate(const Angle &angle)
 {
     rotation += angle;
+    refresh_basis();
 }
 
 void Transform2::scale_by(const Vector2f& factors)
@@ -126,22 +168,32 @@ void Transform2::scale_by(const Vector2f& factors)
 
 Transform2 Transform2::get_translated(const Vector2f &offset) const
 {
-    return Transform2();
+    return Transform2(position + offset, rotation, scale, get_basis());
 }
 
 Transform2 Transform2::get_rotated(const Angle &angle) const
 {
-    return Transform2();
+    return Transform2(position, rotation + angle, scale);
 }
 
 Transform2 gf::Transform2::get_globally_rotated(const Angle &angle) const
 {
-    return Transform2(position.get_rotated(angle), rotation, scale);
+    return Transform2(position.get_rotated(angle), rotation, scale, get_basis());
 }
 
 Transform2 Transform2::get_scaled(const Vector2f &factors) const
 {
-    return Transform2();
+    return Transform2(position, rotation, scale * factors, get_basis());
+}
+
+Transform2 Transform2::get_interpolated(const Transform2 &target, float t) const
+{
+    float rotation_delta = std::remainder(target.rotation.get_radians() - rotation.get_radians(), TWO_PI.get_radians());
+    return Transform2(
+        position + (target.position - position) * t,
+        rotation + Angle{rotation_delta * t},
+        scale + (target.scale - scale) * t
+    );
 }
 
 std::ostream &gf::operator<<(std::ostream &os, const Transform2 &transform)
@@ -0,0 +1,280 @@
+#include "Tween_manager.hpp"
+#include "Profiler.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace gf;
+
+Tween_manager::Tween_handle Tween_manager::add(float start, float end, const Time& length, Easing_type easing, float* target)
+{
+    return add(Kind::scalar, &start, &end, 1, length, easing, target);
+}
+
+Tween_manager::Tween_handle Tween_manager::add(const Vector2f& start, const Vector2f& end, const Time& length, Easing_type easing, Vector2f* target)
+{
+    float starts[] = {start.x, start.y};
+    float ends[] = {end.x, end.y};
+    return add(Kind::vector, starts, ends, 2, length, easing, target);
+}
+
+Tween_manager::Tween_handle Tween_manager::add(const Angle& start, const Angle& end, const Time& length, Easing_type easing, Angle* target)
+{
+    float start_radians = start.get_radians();
+    float end_radians = end.get_radians();
+    wrap_shortest_path(start_radians, end_radians);
+    return add(Kind::angle, &start_radians, &end_radians, 1, length, easing, target);
+}
+
+Tween_manager::Tween_handle Tween_manager::add(const Transform2& start, const Transform2& end, const Time& length, Easing_type easing, Transform2* target)
+{
+    float starts[] = {start.position.x, start.position.y, start.rotation.get_radians(), start.scale.x, start.scale.y};
+    float ends[] = {end.position.x, end.position.y, end.rotation.get_radians(), end.scale.x, end.scale.y};
+    wrap_shortest_path(starts[2], ends[2]);
+    return add(Kind::transform, starts, ends, 5, length, easing, target);
+}
+
+Tween_manager::Tween_handle Tween_manager::add(Kind kind, const float* start, const float* end, std::uint8_t count, const Time& length, Easing_type easing, void* target)
+{
+    Bucket& bucket = buckets[static_cast<std::size_t>(easing)];
+    auto first = static_cast<std::uint32_t>(bucket.value.size());
+    Tween_handle tween = records.insert({kind, easing, count, first, target, false});
+
+    for (std::uint8_t i = 0; i < count; ++i)
+    {
+        bucket.elapsed.push_back(0.0f);
+        bucket.length.push_back(length.get_milliseconds());
+        bucket.start.push_back(start[i]);
+        bucket.end.push_back(end[i]);
+        bucket.value.push_back(start[i]);
+        bucket.owners.push_back(tween);
+    }
+
+    ++tween_count;
+    return tween;
+}
+
+void Tween_manager::update(const Time& dt)
+{
+    GF_PROFILE_SCOPE("Tween_manager::update");
+
+    const float step = dt.get_milliseconds();
+    for (std::size_t type = 0; type < buckets.size(); ++type)
+    {
+        Bucket& bucket = buckets[type];
+        const std::size_t count = bucket.value.size();
+        if (count == 0)
+            continue;
+
+        scratch.resize(count);
+        float* elapsed = bucket.elapsed.data();
+        const float* length = bucket.length.data();
+        const float* start = bucket.start.data();
+        const float* end = bucket.end.data();
+        float* value = bucket.value.data();
+        float* progress = scratch.data();
+
+        // Branch free so that each loop vectorizes, a zero length divides to infinity in the lane that is not selected
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            elapsed[i] += step;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            progress[i] = (elapsed[i] >= length[i]) ? 1.0f : elapsed[i] / length[i];
+        }
+
+        easing::evaluate(static_cast<Easing_type>(type), progress, progress, count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            value[i] = (elapsed[i] >= length[i]) ? end[i] : start[i] + (end[i] - start[i]) * progress[i];
+        }
+
+        // Write targets and compact finished tweens out in one pass, keeping each tween's floats adjacent
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < count;)
+        {
+            Tween_handle tween = bucket.owners[i];
+            Record& record = *records.find(tween);
+            const std::size_t tween_floats = record.count;
+
+            write_target(record, value + i);
+
+            if (elapsed[i] >= length[i])
+            {
+                if (!record.removed)
+                    --tween_count;
+                records.erase(tween);
+            }
+            else
+            {
+                if (kept != i)
+                {
+                    for (std::size_t j = 0; j < tween_floats; ++j)
+                    {
+                        bucket.elapsed[kept + j] = bucket.elapsed[i + j];
+                        bucket.length[kept + j] = bucket.length[i + j];
+                        bucket.start[kept + j] = bucket.start[i + j];
+                        bucket.end[kept + j] = bucket.end[i + j];
+                        bucket.value[kept + j] = bucket.value[i + j];
+                        bucket.owners[kept + j] = bucket.owners[i + j];
+                    }
+                    record.first = static_cast<std::uint32_t>(kept);
+                }
+                kept += tween_floats;
+            }
+            i += tween_floats;
+        }
+
+        bucket.elapsed.resize(kept);
+        bucket.length.resize(kept);
+        bucket.start.resize(kept);
+        bucket.end.resize(kept);
+        bucket.value.resize(kept);
+        bucket.owners.resize(kept);
+    }
+}
+
+void Tween_manager::finish(Tween_handle tween)
+{
+    const Record* record = find_running(tween);
+    if (!record)
+    {
+        throw std::out_of_range("Tween handle does not refer to a running tween");
+    }
+
+    Bucket& bucket = buckets[static_cast<std::size_t>(record->easing)];
+    for (std::size_t i = record->first; i < record->first + record->count; ++i)
+    {
+        bucket.elapsed[i] = bucket.length[i];
+        bucket.value[i] = bucket.end[i];
+    }
+    write_target(*record, &bucket.value[record->first]);
+}
+
+void Tween_manager::remove(Tween_handle tween)
+{
+    Record* record = find_running(tween);
+    if (!record)
+        return;
+
+    // Finishing it without a target lets the next update compact it out with the others
+    Bucket& bucket = buckets[static_cast<std::size_t>(record->easing)];
+    for (std::size_t i = record->first; i < record->first + record->count; ++i)
+    {
+        bucket.elapsed[i] = bucket.length[i];
+    }
+    record->target = nullptr;
+    record->removed = true;
+    --tween_count;
+}
+
+bool Tween_manager::contains(Tween_handle tween) const
+{
+    return find_running(tween) != nullptr;
+}
+
+float Tween_manager::get_float(Tween_handle tween) const
+{
+    const Record& record = get_record(tween, Kind::scalar);
+    return buckets[static_cast<std::size_t>(record.easing)].value[record.first];
+}
+
+Vector2f Tween_manager::get_vector(Tween_handle tween) const
+{
+    const Record& record = get_record(tween, Kind::vector);
+    const float* value = &buckets[static_cast<std::size_t>(record.easing)].value[record.first];
+    return {value[0], value[1]};
+}
+
+Angle Tween_manager::get_angle(Tween_handle tween) const
+{
+    const Record& record = get_record(tween, Kind::angle);
+    return Angle{buckets[static_cast<std::size_t>(record.easing)].value[record.first]};
+}
+
+Transform2 Tween_manager::get_transform(Tween_handle tween) const
+{
+    const Record& record = get_record(tween, Kind::transform);
+    const float* value = &buckets[static_cast<std::size_t>(record.easing)].value[record.first];
+    return {Vector2f{value[0], value[1]}, Angle{value[2]}, Vector2f{value[3], value[4]}};
+}
+
+float Tween_manager::get_progress(Tween_handle tween) const
+{
+    const Record* record = find_running(tween);
+    if (!record)
+    {
+        throw std::out_of_range("Tween handle does not refer to a running tween");
+    }
+
+    const Bucket& bucket = buckets[static_cast<std::size_t>(record->easing)];
+    float elapsed = bucket.elapsed[record->first];
+    float length = bucket.length[record->first];
+    return (elapsed >= length) ? 1.0f : elapsed / length;
+}
+
+std::size_t Tween_manager::size() const
+{
+    return tween_count;
+}
+
+void Tween_manager::clear()
+{
+    for (Bucket& bucket : buckets)
+    {
+        for (std::size_t i = 0; i < bucket.owners.size(); ++i)
+            records.erase(bucket.owners[i]);
+        bucket = Bucket();
+    }
+    tween_count = 0;
+}
+
+Tween_manager::Record* Tween_manager::find_running(Tween_handle tween)
+{
+    Record* record = records.find(tween);
+    return (record && !record->removed) ? record : nullptr;
+}
+
+const Tween_manager::Record* Tween_manager::find_running(Tween_handle tween) const
+{
+    const Record* record = records.find(tween);
+    return (record && !record->removed) ? record : nullptr;
+}
+
+const Tween_manager::Record& Tween_manager::get_record(Tween_handle tween, Kind kind) const
+{
+    const Record* record = find_running(tween);
+    if (!record)
+    {
+        throw std::out_of_range("Tween handle does not refer to a running tween");
+    }
+    if (record->kind != kind)
+    {
+        throw std::invalid_argument("Tween is of a different type");
+    }
+    return *record;
+}
+
+void Tween_manager::write_target(const Record& record, const float* value)
+{
+    if (!record.target)
+        return;
+
+    switch (record.kind)
+    {
+        case Kind::scalar:
+            *static_cast<float*>(record.target) = value[0];
+            break;
+        case Kind::vector:
+            *static_cast<Vector2f*>(record.target) = Vector2f{value[0], value[1]};
+            break;
+        case Kind::angle:
+            *static_cast<Angle*>(record.target) = Angle{value[0]};
+            break;
+        case Kind::transform:
+            *static_cast<Transform2*>(record.target) = Transform2{Vector2f{value[0], value[1]}, Angle{value[2]}, Vector2f{value[3], value[4]}};
+            break;
+    }
+}
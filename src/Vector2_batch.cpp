@@ -0,0 +1,361 @@
+#include "Vector2_batch.hpp"
+#include "Simd.hpp"
+
+#include <array>
+
+using namespace gf;
+using namespace gf::simd;
+
+static_assert(sizeof(Vector2f) == 2 * sizeof(float), "Vector2f arrays are read as interleaved floats");
+
+namespace
+{
+    /**
+     * @brief The number of vectors split into x and y arrays at a time, for the Vector2f overloads
+    */
+    constexpr std::size_t block_size = 256;
+
+    /**
+     * @brief Apply a kernel to parallel arrays, a pack at a time
+     *
+     * Every input of a pack is loaded before any output is stored, so outputs may alias inputs.
+     * The tail is padded with zeros into a full pack.
+     *
+     * @param kernel Maps an array of input packs to an array of output packs
+    */
+    template <std::size_t Inputs, std::size_t Outputs, typename Kernel>
+    void apply(Kernel kernel, const std::array<const float*, Inputs>& inputs, const std::array<float*, Outputs>& outputs, std::size_t count)
+    {
+        std::array<Float_pack, Inputs> packs;
+
+        std::size_t i = 0;
+        for (; i + width <= count; i += width)
+        {
+            for (std::size_t k = 0; k < Inputs; ++k)
+                packs[k] = load(inputs[k] + i);
+
+            std::array<Float_pack, Outputs> results = kernel(packs);
+            for (std::size_t k = 0; k < Outputs; ++k)
+                store(outputs[k] + i, results[k]);
+        }
+
+        if (i < count)
+        {
+            float tail[Inputs > Outputs ? Inputs : Outputs][width] = {};
+            for (std::size_t k = 0; k < Inputs; ++k)
+            {
+                for (std::size_t j = 0; i + j < count; ++j)
+                    tail[k][j] = inputs[k][i + j];
+                packs[k] = load(tail[k]);
+            }
+
+            std::array<Float_pack, Outputs> results = kernel(packs);
+            for (std::size_t k = 0; k < Outputs; ++k)
+            {
+                store(tail[k], results[k]);
+                for (std::size_t j = 0; i + j < count; ++j)
+                    outputs[k][i + j] = tail[k][j];
+            }
+        }
+    }
+
+    void split(const Vector2f* vectors, float* x, float* y, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            x[i] = vectors[i].x;
+            y[i] = vectors[i].y;
+        }
+    }
+
+    void join(const float* x, const float* y, Vector2f* vectors, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            vectors[i].x = x[i];
+            vectors[i].y = y[i];
+        }
+    }
+
+    /**
+     * @brief Run a separate array operation that maps vectors to vectors over an array of Vector2f, a block at a time
+    */
+    template <typename Operation>
+    void map_blocks(const Vector2f* vectors, Vector2f* result, std::size_t count, Operation operation)
+    {
+        float x[block_size];
+        float y[block_size];
+        for (std::size_t first = 0; first < count; first += block_size)
+        {
+            std::size_t size = (count - first < block_size) ? count - first : block_size;
+            split(vectors + first, x, y, size);
+            operation(x, y, size);
+            join(x, y, result + first, size);
+        }
+    }
+
+    /**
+     * @brief Run a separate array operation that maps pairs of vectors to floats over arrays of Vector2f, a block at a time
+    */
+    template <typename Operation>
+    void reduce_blocks(const Vector2f* a, const Vector2f* b, float* result, std::size_t count, Operation operation)
+    {
+        float a_x[block_size];
+        float a_y[block_size];
+        float b_x[block_size];
+        float b_y[block_size];
+        for (std::size_t first = 0; first < count; first += block_size)
+        {
+            std::size_t size = (count - first < block_size) ? count - first : block_size;
+            split(a + first, a_x, a_y, size);
+            split(b + first, b_x, b_y, size);
+            operation(a_x, a_y, b_x, b_y, result + first, size);
+        }
+    }
+
+    /**
+     * @brief The sine and cosine of a pack of angles, the polynomial tiers of Angle::sincos
+    */
+    std::array<Float_pack, 2> sin_cos(Float_pack radians, Trig_precision precision)
+    {
+        Float_pack q = round(radians * splat(detail::two_over_pi));
+        Float_pack r = ((radians - q * splat(detail::half_pi_part1)) - q * splat(detail::half_pi_part2)) - q * splat(detail::half_pi_part3);
+        Float_pack r2 = r * r;
+
+        Float_pack sin_r;
+        Float_pack cos_r;
+        if (precision == Trig_precision::high)
+        {
+            sin_r = r + r * r2 * (splat(detail::sin_high[0]) + r2 * (splat(detail::sin_high[1]) + r2 * splat(detail::sin_high[2])));
+            cos_r = splat(1.0f) - splat(0.5f) * r2 + r2 * r2 * (splat(detail::cos_high[0]) + r2 * (splat(detail::cos_high[1]) + r2 * splat(detail::cos_high[2])));
+        }
+        else
+        {
+            sin_r = r + r * r2 * (splat(detail::sin_fast[0]) + r2 * splat(detail::sin_fast[1]));
+            cos_r = splat(1.0f) + r2 * (splat(detail::cos_fast[0]) + r2 * splat(detail::cos_fast[1]));
+        }
+
+        // The quadrant is worked out in floats, there being no integer lanes on every target.
+        // even is zero for even quadrants, turn is the quadrant as one of -2, -1, 0, 1 or 2
+        Float_pack even = q - splat(2.0f) * round(q * splat(0.5f));
+        Float_pack turn = q - splat(4.0f) * round(q * splat(0.25f));
+        Mask_pack swap_mask = even == splat(0.0f);
+        Mask_pack half_turn = splat(2.5f) < turn * turn;
+
+        Float_pack sin_of = select(swap_mask, sin_r, cos_r);
+        Float_pack cos_of = select(swap_mask, cos_r, sin_r);
+        sin_of = select(half_turn, splat(0.0f) - sin_of, select(turn < splat(-0.5f), splat(0.0f) - sin_of, sin_of));
+        cos_of = select(half_turn, splat(0.0f) - cos_of, select(splat(0.5f) < turn, splat(0.0f) - cos_of, cos_of));
+        return {sin_of, cos_of};
+    }
+}
+
+void batch::rotate(const float* x, const float* y, float* result_x, float* result_y, std::size_t count, const Angle& angle)
+{
+    const Sin_cos sin_cos_of = angle.sincos();
+    const Float_pack sin_of = splat(sin_cos_of.sin);
+    const Float_pack cos_of = splat(sin_cos_of.cos);
+    apply<2, 2>([&](const std::array<Float_pack, 2>& v) -> std::array<Float_pack, 2>
+    {
+        return {v[0] * cos_of - v[1] * sin_of, v[0] * sin_of + v[1] * cos_of};
+    }, {x, y}, {result_x, result_y}, count);
+}
+
+void batch::rotate(const Vector2f* vectors, Vector2f* result, std::size_t count, const Angle& angle)
+{
+    map_blocks(vectors, result, count, [&](float* x, float* y, std::size_t size) { rotate(x, y, x, y, size, angle); });
+}
+
+void batch::rotate(const float* x, const float* y, const float* radians, float* result_x, float* result_y, std::size_t count, Trig_precision precision)
+{
+    if (precision == Trig_precision::exact)
+    {
+        // The standard library a block at a time, then rotating with the packs
+        float sines[block_size];
+        float cosines[block_size];
+        for (std::size_t first = 0; first < count; first += block_size)
+        {
+            std::size_t size = (count - first < block_size) ? count - first : block_size;
+            get_sin_cos(radians + first, sines, cosines, size, precision);
+            apply<4, 2>([](const std::array<Float_pack, 4>& v) -> std::array<Float_pack, 2>
+            {
+                return {v[0] * v[3] - v[1] * v[2], v[0] * v[2] + v[1] * v[3]};
+            }, {x + first, y + first, sines, cosines}, {result_x + first, result_y + first}, size);
+        }
+        return;
+    }
+
+    apply<3, 2>([precision](const std::array<Float_pack, 3>& v) -> std::array<Float_pack, 2>
+    {
+        std::array<Float_pack, 2> sin_cos_of = sin_cos(v[2], precision);
+        return {v[0] * sin_cos_of[1] - v[1] * sin_cos_of[0], v[0] * sin_cos_of[0] + v[1] * sin_cos_of[1]};
+    }, {x, y, radians}, {result_x, result_y}, count);
+}
+
+void batch::rotate(const Vector2f* vectors, const float* radians, Vector2f* result, std::size_t count, Trig_precision precision)
+{
+    float x[block_size];
+    float y[block_size];
+    for (std::size_t first = 0; first < count; first += block_size)
+    {
+        std::size_t size = (count - first < block_size) ? count - first : block_size;
+        split(vectors + first, x, y, size);
+        rotate(x, y, radians + first, x, y, size, precision);
+        join(x, y, result + first, size);
+    }
+}
+
+void batch::get_sin_cos(const float* radians, float* sines, float* cosines, std::size_t count, Trig_precision precision)
+{
+    if (precision == Trig_precision::exact)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            Sin_cos sin_cos_of = Angle{radians[i]}.sincos();
+            sines[i] = sin_cos_of.sin;
+            cosines[i] = sin_cos_of.cos;
+        }
+        return;
+    }
+
+    apply<1, 2>([precision](const std::array<Float_pack, 1>& v) { return sin_cos(v[0], precision); }, {radians}, {sines, cosines}, count);
+}
+
+void batch::transform(const float* x, const float* y, float* result_x, float* result_y, std::size_t count, const Matrix2x3& matrix)
+{
+    const Float_pack x_axis_x = splat(matrix.x_axis.x);
+    const Float_pack x_axis_y = splat(matrix.x_axis.y);
+    const Float_pack y_axis_x = splat(matrix.y_axis.x);
+    const Float_pack y_axis_y = splat(matrix.y_axis.y);
+    const Float_pack origin_x = splat(matrix.origin.x);
+    const Float_pack origin_y = splat(matrix.origin.y);
+    apply<2, 2>([&](const std::array<Float_pack, 2>& v) -> std::array<Float_pack, 2>
+    {
+        return {mul_add(v[1], y_axis_x, mul_add(v[0], x_axis_x, origin_x)), mul_add(v[1], y_axis_y, mul_add(v[0], x_axis_y, origin_y))};
+    }, {x, y}, {result_x, result_y}, count);
+}
+
+void batch::transform(const Vector2f* points, Vector2f* result, std::size_t count, const Matrix2x3& matrix)
+{
+    map_blocks(points, result, count, [&](float* x, float* y, std::size_t size) { transform(x, y, x, y, size, matrix); });
+}
+
+void batch::translate(const float* x, const float* y, float* result_x, float* result_y, std::size_t count, const Vector2f& offset)
+{
+    const Float_pack offset_x = splat(offset.x);
+    const Float_pack offset_y = splat(offset.y);
+    apply<2, 2>([&](const std::array<Float_pack, 2>& v) -> std::array<Float_pack, 2>
+    {
+        return {v[0] + offset_x, v[1] + offset_y};
+    }, {x, y}, {result_x, result_y}, count);
+}
+
+void batch::translate(const Vector2f* vectors, Vector2f* result, std::size_t count, const Vector2f& offset)
+{
+    // Interleaved, the offset is simply added to every float in turn
+    const auto* input = reinterpret_cast<const float*>(vectors);
+    auto* output = reinterpret_cast<float*>(result);
+    for (std::size_t i = 0; i < 2 * count; i += 2)
+    {
+        output[i] = input[i] + offset.x;
+        output[i + 1] = input[i + 1] + offset.y;
+    }
+}
+
+void batch::scale(const float* x, const float* y, float* result_x, float* result_y, std::size_t count, const Vector2f& factors)
+{
+    const Float_pack factor_x = splat(factors.x);
+    const Float_pack factor_y = splat(factors.y);
+    apply<2, 2>([&](const std::array<Float_pack, 2>& v) -> std::array<Float_pack, 2>
+    {
+        return {v[0] * factor_x, v[1] * factor_y};
+    }, {x, y}, {result_x, result_y}, count);
+}
+
+void batch::scale(const Vector2f* vectors, Vector2f* result, std::size_t count, const Vector2f& factors)
+{
+    const auto* input = reinterpret_cast<const float*>(vectors);
+    auto* output = reinterpret_cast<float*>(result);
+    for (std::size_t i = 0; i < 2 * count; i += 2)
+    {
+        output[i] = input[i] * factors.x;
+        output[i + 1] = input[i + 1] * factors.y;
+    }
+}
+
+void batch::normalize(const float* x, const float* y, float* result_x, float* result_y, std::size_t count)
+{
+    apply<2, 2>([](const std::array<Float_pack, 2>& v) -> std::array<Float_pack, 2>
+    {
+        // A true division rather than a reciprocal square root estimate, to match get_normalized
+        Float_pack length = sqrt(v[0] * v[0] + v[1] * v[1]);
+        Mask_pack zero = length == splat(0.0f);
+        Float_pack divisor = select(zero, splat(1.0f), length);
+        return {select(zero, splat(0.0f), v[0] / divisor), select(zero, splat(0.0f), v[1] / divisor)};
+    }, {x, y}, {result_x, result_y}, count);
+}
+
+void batch::normalize(const Vector2f* vectors, Vector2f* result, std::size_t count)
+{
+    map_blocks(vectors, result, count, [](float* x, float* y, std::size_t size) { normalize(x, y, x, y, size); });
+}
+
+void batch::get_lengths(const float* x, const float* y, float* lengths, std::size_t count)
+{
+    apply<2, 1>([](const std::array<Float_pack, 2>& v) -> std::array<Float_pack, 1>
+    {
+        return {sqrt(v[0] * v[0] + v[1] * v[1])};
+    }, {x, y}, {lengths}, count);
+}
+
+void batch::get_lengths(const Vector2f* vectors, float* lengths, std::size_t count)
+{
+    float x[block_size];
+    float y[block_size];
+    for (std::size_t first = 0; first < count; first += block_size)
+    {
+        std::size_t size = (count - first < block_size) ? count - first : block_size;
+        split(vectors + first, x, y, size);
+        get_lengths(x, y, lengths + first, size);
+    }
+}
+
+void batch::get_dot_products(const float* a_x, const float* a_y, const float* b_x, const float* b_y, float* result, std::size_t count)
+{
+    apply<4, 1>([](const std::array<Float_pack, 4>& v) -> std::array<Float_pack, 1>
+    {
+        return {v[0] * v[2] + v[1] * v[3]};
+    }, {a_x, a_y, b_x, b_y}, {result}, count);
+}
+
+void batch::get_dot_products(const Vector2f* a, const Vector2f* b, float* result, std::size_t count)
+{
+    reduce_blocks(a, b, result, count, [](const float* a_x, const float* a_y, const float* b_x, const float* b_y, float* block_result, std::size_t size)
+    {
+        get_dot_products(a_x, a_y, b_x, b_y, block_result, size);
+    });
+}
+
+void batch::get_cross_products(const float* a_x, const float* a_y, const float* b_x, const float* b_y, float* result, std::size_t count)
+{
+    apply<4, 1>([](const std::array<Float_pack, 4>& v) -> std::array<Float_pack, 1>
+    {
+        return {v[0] * v[3] - v[1] * v[2]};
+    }, {a_x, a_y, b_x, b_y}, {result}, count);
+}
+
+void batch::get_cross_products(const Vector2f* a, const Vector2f* b, float* result, std::size_t count)
+{
+    reduce_blocks(a, b, result, count, [](const float* a_x, const float* a_y, const float* b_x, const float* b_y, float* block_result, std::size_t size)
+    {
+        get_cross_products(a_x, a_y, b_x, b_y, block_result, size);
+    });
+}
+
+void batch::lerp(const float* start, const float* end, const float* t, float* result, std::size_t count)
+{
+    apply<3, 1>([](const std::array<Float_pack, 3>& v) -> std::array<Float_pack, 1>
+    {
+        return {select(v[2] == splat(1.0f), v[1], v[0] + (v[1] - v[0]) * v[2])};
+    }, {start, end, t}, {result}, count);
+}
@@ -0,0 +1,120 @@
+#include "World.hpp"
+
+#include <stdexcept>
+
+using namespace gf;
+
+World::World(Scene_graph& scene):
+    scene{&scene}
+{}
+
+World::~World()
+{
+    clear();
+}
+
+Game_object* World::spawn(Game_object* parent)
+{
+    Game_object* object = scene ? objects.create(*scene) : objects.create();
+    if (parent)
+    {
+        try
+        {
+            parent->add_child(object);
+        }
+        catch (...)
+        {
+            objects.destroy(object);
+            throw;
+        }
+    }
+    return object;
+}
+
+void World::despawn(Game_object* object)
+{
+    if (!objects.owns(object))
+    {
+        throw std::invalid_argument("Object was not spawned by this world");
+    }
+
+    // Each child removes itself from the list when it is destroyed. Children this world did not
+    // spawn are detached and survive as roots, as when an object is destroyed directly, so the
+    // subtree is never left half destroyed.
+    while (!object->children.empty())
+    {
+        Game_object* child = object->children.back().get();
+        if (!child)
+            object->children.pop_back();
+        else if (objects.owns(child))
+            despawn(child);
+        else
+            object->remove_child(child);
+    }
+
+    components.remove_all(*object);
+    for (auto& component : object->components)
+    {
+        release_component(component);
+    }
+    object->components.clear();
+
+    objects.destroy(object);
+}
+
+Component_registry& World::get_components()
+{
+    return components;
+}
+
+void World::clear()
+{
+    components = Component_registry();
+
+    // Unlink everything first so that no destructor walks into another object
+    objects.for_each([this](Game_object& object)
+    {
+        for (auto& component : object.components)
+        {
+            // Pooled components are destroyed with their pools below
+            auto pool = component_pools.find(typeid(*component));
+            if (pool == component_pools.end() || !pool->second->owns(component))
+                delete component;
+        }
+        object.components.clear();
+
+        // Objects outside the world keep their links to it, detach them before the slots die
+        for (std::size_t i = object.children.size(); i-- > 0;)
+        {
+            Game_object* child = object.children[i].get();
+            if (child && !objects.owns(child))
+                object.remove_child(child);
+        }
+        Game_object* parent = object.parent.get();
+        if (parent && !objects.owns(parent))
+            parent->remove_child(&object);
+
+        object.children.clear();
+        object.parent = Game_object_handle();
+    });
+
+    for (auto& pool : component_pools)
+    {
+        pool.second->clear();
+    }
+    objects.clear();
+}
+
+std::size_t World::size() const
+{
+    return objects.size();
+}
+
+void World::release_component(Game_object_component* component)
+{
+    auto pool = component_pools.find(typeid(*component));
+    if (pool != component_pools.end() && pool->second->owns(component))
+        pool->second->destroy(component);
+    else
+        delete component;
+}
@@ -1,19 +1,94 @@
 #include "components/Position_solver.hpp"
 
-gf::component::Position_solver::Position_solver(Game_object &game_object):
-    game_object{game_object}
-{}
+#include <cmath>
+
+gf::component::Position_solver::Position_solver(Game_object &game_object)
+{
+    set_owner(&game_object);
+}
 
 void gf::component::Position_solver::update(const gf::Time& dt)
 {
     if (process)
     {
         process->update(dt);
-        game_object.transform = process->get();
+        owner->set_transform(process->get());
+
+        // Writing the transform marks the owner dirty, so stop once the end has been written
+        if (process->get_finished())
+            process.reset();
+    }
+    else if (path)
+    {
+        path_distance += path_speed * dt.get_seconds();
+
+        float length = path->get_length();
+        bool finished = false;
+        if (path_loop && length > 0.0f)
+        {
+            path_distance = std::fmod(path_distance, length);
+            if (path_distance < 0.0f)
+                path_distance += length;
+        }
+        else if (path_distance >= length)
+        {
+            path_distance = length;
+            finished = true;
+        }
+        else if (path_distance < 0.0f)
+        {
+            // A negative speed runs the path backwards and stops at its start
+            path_distance = 0.0f;
+            finished = true;
+        }
+
+        gf::Transform2 transform = owner->get_transform();
+        transform.position = path->get_point_at_distance(path_distance);
+        if (path_orient)
+            transform.set_rotation(path->get_direction_at_distance(path_distance).get_angle());
+        owner->set_transform(transform);
+
+        if (finished)
+            path = nullptr;
     }
 }
 
 void gf::component::Position_solver::set_target_position(const gf::Transform2 &target, gf::Time duration, gf::Easing_function interpolation)
 {
-    process.emplace(game_object.transform, target, duration, interpolation);
+    path = nullptr;
+    if (interpolation.is_custom())
+    {
+        custom_easing = std::make_unique<gf::Easing_table>(interpolation);
+        process.emplace(owner->get_transform(), target, duration, *custom_easing);
+    }
+    else
+    {
+        process.emplace(owner->get_transform(), target, duration, interpolation.get_type());
+        custom_easing.reset();
+    }
+}
+
+void gf::component::Position_solver::follow_path(const gf::Spline_path& new_path, float speed, bool loop, bool orient)
+{
+    process.reset();
+    path = &new_path;
+    path_distance = 0.0f;
+    path_speed = speed;
+    path_loop = loop;
+    path_orient = orient;
+}
+
+void gf::component::Position_solver::stop_following_path()
+{
+    path = nullptr;
+}
+
+bool gf::component::Position_solver::get_following_path() const
+{
+    return path != nullptr;
+}
+
+float gf::component::Position_solver::get_path_distance() const
+{
+    return path_distance;
 }